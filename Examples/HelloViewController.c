@@ -119,7 +119,10 @@ static ident valueForColumnAndRow(const TableView *tableView, const TableColumn
  */
 static TableCellView *cellForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
 
-  TableCellView *cell = $(alloc(TableCellView), initWithFrame, NULL);
+  TableCellView *cell = $(tableView, dequeueReusableCell, column);
+  if (cell == NULL) {
+    cell = $(alloc(TableCellView), initWithFrame, NULL);
+  }
 
   const ssize_t col = $((Array *) tableView->columns, indexOfObject, (ident) column);
 
@@ -140,37 +143,15 @@ static void didSelectRowsAtIndexes(TableView *tableView, const IndexSet *indexes
   release(string);
 }
 
-static TableView *_tableView;
-
 /**
  * @brief Comparator for table sorting.
  */
-static int comparator(const void *a, const void *b) {
-
-  const ssize_t col = $((Array *) _tableView->columns, indexOfObject, _tableView->sortColumn);
-
-  switch (_tableView->sortColumn->order) {
-    case OrderAscending:
-      return *(int *)(a + col) - *(int *)(b + col);
-    case OrderDescending:
-      return *(int *)(b + col) - *(int *)(a + col);
-    case OrderSame:
-      return 0;
-  }
-}
-
-/**
- * @see TableViewDelegate::didSetSortColumn
- */
-static void didSetSortColumn(TableView *tableView) {
+static Order comparator(const ident a, const ident b) {
 
-  _tableView = tableView;
-  if (_tableView->sortColumn) {
+  const intptr_t i = (intptr_t) a;
+  const intptr_t j = (intptr_t) b;
 
-    qsort(tableData, lengthof(tableData), sizeof(tableData[0]), comparator);
-
-    $(tableView, reloadData);
-  }
+  return i < j ? OrderAscending : i > j ? OrderDescending : OrderSame;
 }
 
 #pragma mark - CollectionViewDataSource
@@ -196,7 +177,10 @@ static ident objectForItemAtIndexPath(const CollectionView *collectionView, cons
  */
 static CollectionItemView *itemForObjectAtIndexPath(const CollectionView *collectionView, const IndexPath *indexPath) {
 
-  CollectionItemView *item = $(alloc(CollectionItemView), initWithFrame, NULL);
+  CollectionItemView *item = $(collectionView, dequeueReusableItem);
+  if (item == NULL) {
+    item = $(alloc(CollectionItemView), initWithFrame, NULL);
+  }
 
   char text[64];
   snprintf(text, sizeof(text), "%zd", $(indexPath, indexAtPosition, 0));
@@ -274,10 +258,12 @@ static void loadView(ViewController *self) {
   this->checkbox->delegate.didToggle = didToggleCheckbox;
   this->textView->delegate.didEndEditing = didEndEditing;
 
+  $(this->select, beginUpdates);
   $(this->select, addOption, "This is a select", (ident) 1);
   $(this->select, addOption, "This is an option", (ident) 2);
   $(this->select, addOption, "This is another", (ident) 3);
   $(this->select, addOption, "This is yet another", (ident) 4);
+  $(this->select, endUpdates);
   this->select->delegate.didSelectOption = didSelectOption;
 
   this->slider->delegate.didSetValue = didSetValue;
@@ -286,7 +272,11 @@ static void loadView(ViewController *self) {
   this->tableView->dataSource.valueForColumnAndRow = valueForColumnAndRow;
   this->tableView->delegate.cellForColumnAndRow = cellForColumnAndRow;
   this->tableView->delegate.didSelectRowsAtIndexes = didSelectRowsAtIndexes;
-  this->tableView->delegate.didSetSortColumn = didSetSortColumn;
+
+  const Array *columns = (Array *) this->tableView->columns;
+  for (size_t i = 0; i < columns->count; i++) {
+    ((TableColumn *) columns->elements[i])->comparator = comparator;
+  }
 
   $(this->tableView, reloadData);
 
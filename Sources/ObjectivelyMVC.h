@@ -28,6 +28,7 @@
  * @brief ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
  */
 
+#include <ObjectivelyMVC/Atom.h>
 #include <ObjectivelyMVC/Box.h>
 #include <ObjectivelyMVC/Button.h>
 #include <ObjectivelyMVC/Checkbox.h>
@@ -40,8 +41,10 @@
 #include <ObjectivelyMVC/HSVColorPicker.h>
 #include <ObjectivelyMVC/HueColorPicker.h>
 #include <ObjectivelyMVC/Image.h>
+#include <ObjectivelyMVC/ImageRequest.h>
 #include <ObjectivelyMVC/ImageView.h>
 #include <ObjectivelyMVC/Input.h>
+#include <ObjectivelyMVC/InvalidationSet.h>
 #include <ObjectivelyMVC/Label.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/NavigationViewController.h>
@@ -49,18 +52,21 @@
 #include <ObjectivelyMVC/PageView.h>
 #include <ObjectivelyMVC/Panel.h>
 #include <ObjectivelyMVC/ProgressBar.h>
+#include <ObjectivelyMVC/RangeSet.h>
 #include <ObjectivelyGPU/RenderDevice.h>
 #include <ObjectivelyMVC/Renderer.h>
 #include <ObjectivelyMVC/RGBColorPicker.h>
 #include <ObjectivelyMVC/ScrollView.h>
 #include <ObjectivelyMVC/Select.h>
 #include <ObjectivelyMVC/Selector.h>
+#include <ObjectivelyMVC/SelectorFilter.h>
 #include <ObjectivelyMVC/SelectorSequence.h>
 #include <ObjectivelyMVC/SimpleSelector.h>
 #include <ObjectivelyMVC/Slider.h>
 #include <ObjectivelyMVC/SlideShowView.h>
 #include <ObjectivelyMVC/StackView.h>
 #include <ObjectivelyMVC/Style.h>
+#include <ObjectivelyMVC/StyleValue.h>
 #include <ObjectivelyMVC/Stylesheet.h>
 #include <ObjectivelyMVC/TableCellView.h>
 #include <ObjectivelyMVC/TableColumn.h>
@@ -78,5 +84,6 @@
 #include <ObjectivelyMVC/View.h>
 #include <ObjectivelyMVC/View+JSON.h>
 #include <ObjectivelyMVC/ViewController.h>
+#include <ObjectivelyMVC/ViewTemplate.h>
 #include <ObjectivelyMVC/Window.h>
 #include <ObjectivelyMVC/WindowController.h>
@@ -0,0 +1,177 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL_atomic.h>
+
+#include <Objectively.h>
+
+#include "Atom.h"
+
+/**
+ * @brief The interned strings, indexed by Atom.
+ */
+static char **_names;
+
+/**
+ * @brief The count and capacity of `_names`, including the unused zero Atom.
+ */
+static size_t _count = 1, _capacity;
+
+/**
+ * @brief The Atom hash table, open addressed, its size a power of two.
+ */
+static Atom *_table;
+
+/**
+ * @brief The size of `_table`.
+ */
+static size_t _tableSize;
+
+/**
+ * @brief Guards the Atom table, so that Selectors may be parsed on any thread.
+ */
+static SDL_SpinLock _lock;
+
+/**
+ * @return The slot for `name` in `_table`, which is either empty or holds its Atom.
+ */
+static size_t slotForName(const char *name) {
+
+  size_t i = (unsigned int) HashForCString(HASH_SEED, name) & (_tableSize - 1);
+
+  while (_table[i]) {
+    if (strcmp(_names[_table[i]], name) == 0) {
+      break;
+    }
+    i = (i + 1) & (_tableSize - 1);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Doubles the size of the hash table, reinserting all Atoms.
+ */
+static void growTable(void) {
+
+  free(_table);
+
+  _tableSize = _tableSize ? _tableSize << 1 : 256;
+  _table = calloc(_tableSize, sizeof(Atom));
+  assert(_table);
+
+  for (Atom atom = 1; atom < _count; atom++) {
+    _table[slotForName(_names[atom])] = atom;
+  }
+}
+
+Atom MVC_Atom(const char *name) {
+
+  assert(name);
+
+  SDL_LockSpinlock(&_lock);
+
+  if (_count << 1 >= _tableSize) {
+    growTable();
+  }
+
+  const size_t slot = slotForName(name);
+
+  Atom atom = _table[slot];
+  if (atom == 0) {
+
+    if (_count == _capacity) {
+      _capacity = _capacity ? _capacity << 1 : 128;
+      _names = realloc(_names, _capacity * sizeof(char *));
+      assert(_names);
+    }
+
+    atom = (Atom) _count++;
+
+    _names[atom] = strdup(name);
+    assert(_names[atom]);
+
+    _table[slot] = atom;
+  }
+
+  SDL_UnlockSpinlock(&_lock);
+
+  return atom;
+}
+
+Atom MVC_AtomForName(const char *name) {
+
+  Atom atom = 0;
+
+  if (name) {
+    SDL_LockSpinlock(&_lock);
+
+    if (_table) {
+      atom = _table[slotForName(name)];
+    }
+
+    SDL_UnlockSpinlock(&_lock);
+  }
+
+  return atom;
+}
+
+const char *MVC_AtomName(Atom atom) {
+
+  const char *name = NULL;
+
+  SDL_LockSpinlock(&_lock);
+
+  if (atom && atom < _count) {
+    name = _names[atom];
+  }
+
+  SDL_UnlockSpinlock(&_lock);
+
+  return name;
+}
+
+String *MVC_AtomsDescription(const Atom *atoms, size_t count) {
+
+  size_t length = 0;
+  for (size_t i = 0; i < count; i++) {
+    length += strlen(MVC_AtomName(atoms[i]) ?: "") + 1;
+  }
+
+  char *chars = calloc(1, length + 1);
+  assert(chars);
+
+  for (size_t i = 0; i < count; i++) {
+    strcat(chars, ".");
+    strcat(chars, MVC_AtomName(atoms[i]) ?: "");
+  }
+
+  String *string = $$(String, stringWithCharacters, chars);
+
+  free(chars);
+  return string;
+}
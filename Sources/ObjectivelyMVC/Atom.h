@@ -0,0 +1,65 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/String.h>
+
+#include <ObjectivelyMVC/Types.h>
+
+/**
+ * @file
+ * @brief Atoms are interned strings, such as View class names, compared by identity.
+ */
+
+/**
+ * @brief An interned string. Atoms are never zero, so that zero may denote no Atom.
+ */
+typedef unsigned int Atom;
+
+/**
+ * @brief Interns the given string.
+ * @param name The string.
+ * @return The Atom for `name`, which is the same for all equal strings.
+ * @remarks Atoms are never released, and should be used for small vocabularies only.
+ */
+OBJECTIVELYMVC_EXPORT Atom MVC_Atom(const char *name);
+
+/**
+ * @param name The string.
+ * @return The Atom for `name`, or `0` if `name` has never been interned.
+ */
+OBJECTIVELYMVC_EXPORT Atom MVC_AtomForName(const char *name);
+
+/**
+ * @param atom The Atom.
+ * @return The interned string for `atom`, or `NULL`.
+ */
+OBJECTIVELYMVC_EXPORT const char *MVC_AtomName(Atom atom);
+
+/**
+ * @param atoms The Atoms.
+ * @param count The count of `atoms`.
+ * @return A String of the given Atoms in class selector notation, e.g. `.foo.bar`.
+ */
+OBJECTIVELYMVC_EXPORT String *MVC_AtomsDescription(const Atom *atoms, size_t count);
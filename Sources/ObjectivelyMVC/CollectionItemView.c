@@ -53,11 +53,10 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
   assert(simpleSelector);
 
   const CollectionItemView *this = (CollectionItemView *) self;
-  const char *pattern = simpleSelector->pattern;
 
   switch (simpleSelector->type) {
     case SimpleSelectorTypePseudo:
-      if (strcmp("selected", pattern) == 0) {
+      if (simpleSelector->pseudoClass == PseudoClassSelected) {
         return this->isSelected;
       }
       break;
@@ -68,6 +67,44 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
   return super(View, self, matchesSelector, simpleSelector);
 }
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  CollectionItemView *this = (CollectionItemView *) self;
+  const CollectionItemView *that = (CollectionItemView *) prototype;
+
+  ImageView *imageView = (ImageView *) $(self, counterpart, prototype, (View *) that->imageView);
+  if (imageView && imageView != this->imageView) {
+    release(this->imageView);
+    this->imageView = retain(imageView);
+  }
+
+  View *selectionOverlay = $(self, counterpart, prototype, that->selectionOverlay);
+  if (selectionOverlay && selectionOverlay != this->selectionOverlay) {
+    release(this->selectionOverlay);
+    this->selectionOverlay = retain(selectionOverlay);
+  }
+
+  Text *text = (Text *) $(self, counterpart, prototype, (View *) that->text);
+  if (text && text != this->text) {
+    release(this->text);
+    this->text = retain(text);
+  }
+
+  this->isSelected = that->isSelected;
+}
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+  return (View *) $((CollectionItemView *) self, initWithFrame, NULL);
+}
+
 #pragma mark - CollectionItemView
 
 /**
@@ -112,7 +149,11 @@ static CollectionItemView *initWithFrame(CollectionItemView *self, const SDL_Rec
  * @memberof CollectionItemView
  */
 static void setSelected(CollectionItemView *self, bool isSelected) {
-  self->isSelected = isSelected;
+
+  if (isSelected != self->isSelected) {
+    self->isSelected = isSelected;
+    $((View *) self, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, "selected");
+  }
 }
 
 #pragma mark - Class lifecycle
@@ -124,6 +165,8 @@ static void initialize(Class *clazz) {
 
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->matchesSelector = matchesSelector;
   
   ((CollectionItemViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
@@ -23,8 +23,11 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "CollectionView.h"
+#include "Theme.h"
 
 const EnumName CollectionViewAxisNames[] = MakeEnumNames(
   MakeEnumAlias(CollectionViewAxisHorizontal, horizontal),
@@ -33,6 +36,11 @@ const EnumName CollectionViewAxisNames[] = MakeEnumNames(
 
 #define _Class _CollectionView
 
+/**
+ * @brief The number of frames of scrolling, at the current speed, for which items are prefetched.
+ */
+#define PREFETCH_FRAMES 8
+
 #pragma mark - Object
 
 /**
@@ -45,8 +53,11 @@ static void dealloc(Object *self) {
   memset(&this->delegate, 0, sizeof(this->delegate));
 
   release(this->contentView);
+  release(this->itemPrototype);
   release(this->items);
+  release(this->reusableItems);
   release(this->scrollView);
+  release(this->selectedItems);
 
   super(Object, self, dealloc);
 }
@@ -62,13 +73,26 @@ static void applyStyle(View *self, const Style *style) {
 
   CollectionView *this = (CollectionView *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("axis", InletTypeEnum, &this->axis, (ident) CollectionViewAxisNames),
-    MakeInlet("item-size", InletTypeSize, &this->itemSize, NULL),
-    MakeInlet("item-spacing", InletTypeSize, &this->itemSpacing, NULL)
-  );
+  for (size_t i = 0; i < style->numValues; i++) {
+
+    StyleValue *value = style->values[i];
+
+    switch (value->property) {
+      case StylePropertyAxis:
+        $(value, bind, InletTypeEnum, &this->axis, (ident) CollectionViewAxisNames);
+        break;
+      case StylePropertyItemSize:
+        $(value, bind, InletTypeSize, &this->itemSize, NULL);
+        break;
+      case StylePropertyItemSpacing:
+        $(value, bind, InletTypeSize, &this->itemSpacing, NULL);
+        break;
+      default:
+        continue;
+    }
 
-  $(self, bind, inlets, (Dictionary *) style->attributes);
+    self->needsLayout = true;
+  }
 }
 
 /**
@@ -78,6 +102,534 @@ static View *init(View *self) {
   return (View *) $((CollectionView *) self, initWithFrame, NULL);
 }
 
+/**
+ * @return The number of items in each row (vertical) or column (horizontal) of the grid.
+ */
+static size_t itemsPerLine(const CollectionView *self) {
+
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+
+  int extent, size, spacing;
+  switch (self->axis) {
+    case CollectionViewAxisVertical:
+      extent = bounds.w - bounds.x;
+      size = self->itemSize.w;
+      spacing = self->itemSpacing.w;
+      break;
+    case CollectionViewAxisHorizontal:
+      extent = bounds.h - bounds.y;
+      size = self->itemSize.h;
+      spacing = self->itemSpacing.h;
+      break;
+  }
+
+  if (size + spacing > 0) {
+    return 1 + max(0, extent - size) / (size + spacing);
+  }
+
+  return 1;
+}
+
+/**
+ * @return The scroll position of the content View along the primary axis.
+ */
+static int scrollPosition(const CollectionView *self) {
+
+  const SDL_Point offset = self->scrollView->contentOffset;
+
+  switch (self->axis) {
+    case CollectionViewAxisVertical:
+      return -offset.y;
+    case CollectionViewAxisHorizontal:
+      return -offset.x;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Discards the prefetched items, without cancelling them, after the items have changed.
+ */
+static void resetPrefetching(CollectionView *self) {
+
+  self->prefetchedItems = (Range) { .location = 0, .length = 0 };
+  self->prefetchOffset = scrollPosition(self);
+}
+
+/**
+ * @brief Passes the index paths of the given items to a prefetching callback.
+ */
+static void notifyPrefetching(CollectionView *self, void (*callback)(const CollectionView *, const Array *), const size_t *indexes, size_t count) {
+
+  if (callback && count) {
+
+    Array *indexPaths = $$(Array, arrayWithCapacity, count);
+    assert(indexPaths);
+
+    for (size_t i = 0; i < count; i++) {
+
+      IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, indexes[i]);
+      $(indexPaths, addObject, indexPath);
+
+      release(indexPath);
+    }
+
+    callback(self, indexPaths);
+
+    release(indexPaths);
+  }
+}
+
+/**
+ * @brief Resolves the range of items in and adjacent to the visible region of the scroll view.
+ * @param self The CollectionView.
+ * @param first The index of the first visible item.
+ * @param last One past the index of the last visible item.
+ */
+static void visibleItems(const CollectionView *self, size_t *first, size_t *last) {
+
+  *first = *last = 0;
+
+  if (self->numberOfItems == 0) {
+    return;
+  }
+
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+  const SDL_Point offset = self->scrollView->contentOffset;
+
+  int top, extent, pitch;
+  switch (self->axis) {
+    case CollectionViewAxisVertical:
+      top = -offset.y - bounds.y;
+      extent = bounds.h;
+      pitch = self->itemSize.h + self->itemSpacing.h;
+      break;
+    case CollectionViewAxisHorizontal:
+      top = -offset.x - bounds.x;
+      extent = bounds.w;
+      pitch = self->itemSize.w + self->itemSpacing.w;
+      break;
+  }
+
+  if (pitch <= 0) {
+    *last = self->numberOfItems;
+    return;
+  }
+
+  const size_t perLine = itemsPerLine(self);
+
+  const int firstLine = max(0, top / pitch - 1);
+  const int lastLine = max(0, (top + extent) / pitch + 2);
+
+  *first = min((size_t) firstLine * perLine, self->numberOfItems);
+  *last = min((size_t) lastLine * perLine, self->numberOfItems);
+}
+
+/**
+ * @brief qsort comparator for item indexes.
+ */
+static int compareIndexes(const void *a, const void *b) {
+
+  const size_t i = *(const size_t *) a;
+  const size_t j = *(const size_t *) b;
+
+  return (i > j) - (i < j);
+}
+
+/**
+ * @return The distinct item indexes of `indexPaths`, in ascending order.
+ */
+static size_t *indexesForIndexPaths(const Array *indexPaths, size_t *count) {
+
+  size_t *indexes = calloc(indexPaths->count, sizeof(size_t));
+  assert(indexes);
+
+  for (size_t i = 0; i < indexPaths->count; i++) {
+    indexes[i] = $((IndexPath *) indexPaths->elements[i], indexAtPosition, 0);
+  }
+
+  qsort(indexes, indexPaths->count, sizeof(size_t), compareIndexes);
+
+  *count = 0;
+  for (size_t i = 0; i < indexPaths->count; i++) {
+    if (*count == 0 || indexes[*count - 1] != indexes[i]) {
+      indexes[(*count)++] = indexes[i];
+    }
+  }
+
+  return indexes;
+}
+
+/**
+ * @return The index of `index` after the items at `inserted` were inserted.
+ */
+static size_t indexAfterInsertion(const size_t *inserted, size_t count, size_t index) {
+
+  size_t low = 0, high = count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (inserted[mid] - mid <= index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  return index + low;
+}
+
+/**
+ * @return The index of `index` after the items at `deleted` were deleted, or `-1` if it was deleted.
+ */
+static ssize_t indexAfterDeletion(const size_t *deleted, size_t count, size_t index) {
+
+  size_t low = 0, high = count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (deleted[mid] < index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  if (low < count && deleted[low] == index) {
+    return -1;
+  }
+
+  return index - low;
+}
+
+/**
+ * @return The index of `index` after the item at `from` was moved to `to`.
+ */
+static size_t indexAfterMove(size_t from, size_t to, size_t index) {
+
+  if (index == from) {
+    return to;
+  } else if (from < to && index > from && index <= to) {
+    return index - 1;
+  } else if (to < from && index >= to && index < from) {
+    return index + 1;
+  }
+
+  return index;
+}
+
+/**
+ * @brief Shifts the selection to account for the items inserted at `inserted`.
+ */
+static void insertSelectedItems(CollectionView *self, const size_t *inserted, size_t count) {
+
+  for (size_t i = 0; i < count;) {
+
+    size_t j = i + 1;
+    while (j < count && inserted[j] == inserted[j - 1] + 1) {
+      j++;
+    }
+
+    $(self->selectedItems, insertIndexesInRange, (Range) { .location = inserted[i], .length = j - i });
+    i = j;
+  }
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterInsertion(inserted, count, self->selectionAnchor);
+  }
+}
+
+/**
+ * @brief Removes and shifts the selection to account for the items deleted at `deleted`.
+ */
+static void deleteSelectedItems(CollectionView *self, const size_t *deleted, size_t count) {
+
+  for (size_t i = count; i > 0;) {
+
+    size_t j = i - 1;
+    while (j > 0 && deleted[j - 1] + 1 == deleted[j]) {
+      j--;
+    }
+
+    $(self->selectedItems, deleteIndexesInRange, (Range) { .location = deleted[j], .length = i - j });
+    i = j;
+  }
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterDeletion(deleted, count, self->selectionAnchor);
+  }
+}
+
+/**
+ * @brief Selects the items between the selection anchor and the specified item, inclusive.
+ */
+static void selectItemsFromAnchor(CollectionView *self, size_t index) {
+
+  const size_t anchor = self->selectionAnchor;
+
+  const size_t first = min(anchor, index);
+  const size_t last = max(anchor, index);
+
+  $(self->selectedItems, addIndexesInRange, (Range) { .location = first, .length = last - first + 1 });
+
+  const Array *items = (Array *) self->items;
+  for (size_t i = 0; i < items->count; i++) {
+
+    const size_t item = self->firstItem + i;
+    if (item >= first && item <= last) {
+      $((CollectionItemView *) items->elements[i], setSelected, true);
+    }
+  }
+}
+
+/**
+ * @brief Prefetches the items ahead of the visible region in the direction of scrolling, and
+ * cancels prefetched items that are no longer ahead of it.
+ * @param self The CollectionView.
+ * @param first The first visible item.
+ * @param last One past the last visible item.
+ */
+static void prefetchItems(CollectionView *self, size_t first, size_t last) {
+
+  if (self->dataSource.prefetchItemsAtIndexPaths == NULL) {
+    return;
+  }
+
+  const int position = scrollPosition(self);
+  const int delta = position - self->prefetchOffset;
+
+  if (delta == 0) {
+    return;
+  }
+
+  self->prefetchOffset = position;
+
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+
+  int extent, pitch;
+  switch (self->axis) {
+    case CollectionViewAxisVertical:
+      extent = bounds.h;
+      pitch = self->itemSize.h + self->itemSpacing.h;
+      break;
+    case CollectionViewAxisHorizontal:
+      extent = bounds.w;
+      pitch = self->itemSize.w + self->itemSpacing.w;
+      break;
+  }
+
+  if (pitch <= 0) {
+    return;
+  }
+
+  const int distance = min(abs(delta) * PREFETCH_FRAMES, 2 * extent);
+  const size_t count = (size_t) ((distance + pitch - 1) / pitch) * itemsPerLine(self);
+
+  size_t from, to;
+  if (delta > 0) {
+    from = last;
+    to = min(last + count, self->numberOfItems);
+  } else {
+    from = first - min(first, count);
+    to = first;
+  }
+
+  from = min(from, to);
+
+  const size_t oldFrom = self->prefetchedItems.location;
+  const size_t oldTo = oldFrom + self->prefetchedItems.length;
+
+  self->prefetchedItems = (Range) { .location = from, .length = to - from };
+
+  if (oldTo - oldFrom + to - from == 0) {
+    return;
+  }
+
+  size_t *indexes = malloc((oldTo - oldFrom + to - from) * sizeof(size_t));
+  assert(indexes);
+
+  size_t n = 0;
+  for (size_t i = oldFrom; i < oldTo && i < self->numberOfItems; i++) {
+    if ((i < from || i >= to) && (i < first || i >= last)) {
+      indexes[n++] = i;
+    }
+  }
+
+  notifyPrefetching(self, self->dataSource.cancelPrefetchingForItemsAtIndexPaths, indexes, n);
+
+  n = 0;
+  for (size_t i = from; i < to; i++) {
+    if (i < oldFrom || i >= oldTo) {
+      indexes[n++] = i;
+    }
+  }
+
+  notifyPrefetching(self, self->dataSource.prefetchItemsAtIndexPaths, indexes, n);
+
+  free(indexes);
+}
+
+/**
+ * @return A new or reused item for the specified index.
+ */
+static CollectionItemView *createItem(CollectionView *self, size_t index) {
+
+  IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, index);
+
+  CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
+  assert(item);
+
+  $(item, setSelected, $(self, isItemSelectedAtIndexPath, indexPath));
+
+  release(indexPath);
+  return item;
+}
+
+/**
+ * @brief Removes the given item from the content View, and makes it available for reuse,
+ * retaining at most `capacity` items.
+ */
+static void enqueueReusableItem(CollectionView *self, CollectionItemView *item, size_t capacity) {
+
+  $((View *) item, removeFromSuperview);
+
+  if (self->reusableItems->count < capacity) {
+    $(self->reusableItems, addObject, item);
+  }
+}
+
+/**
+ * @brief Instantiates the items in and adjacent to the visible region, and recycles the rest.
+ */
+static void layoutVisibleItems(CollectionView *self) {
+
+  size_t first, last;
+  visibleItems(self, &first, &last);
+
+  const Array *items = (Array *) self->items;
+
+  const size_t oldFirst = self->firstItem;
+  const size_t oldLast = oldFirst + items->count;
+
+  if (first == oldFirst && last == oldLast) {
+    return;
+  }
+
+  for (size_t i = 0; i < items->count; i++) {
+    const size_t index = oldFirst + i;
+    if (index < first || index >= last) {
+      enqueueReusableItem(self, items->elements[i], last - first);
+    }
+  }
+
+  Array *visible = $$(Array, arrayWithCapacity, last - first);
+  assert(visible);
+
+  Theme *theme = self->contentView->window ? $$(Theme, theme, self->contentView->window) : NULL;
+
+  for (size_t i = first; i < last; i++) {
+
+    CollectionItemView *item;
+    if (i >= oldFirst && i < oldLast) {
+      item = retain(items->elements[i - oldFirst]);
+    } else {
+      item = createItem(self, i);
+
+      $(self->contentView, addSubview, (View *) item);
+
+      if (theme) {
+        $((View *) item, applyThemeIfNeeded, theme);
+      }
+    }
+
+    $(visible, addObject, item);
+    release(item);
+  }
+
+  release(self->items);
+  self->items = visible;
+  self->firstItem = first;
+}
+
+/**
+ * @brief Updates the instantiated items after items were inserted, deleted or moved.
+ * @param self The CollectionView.
+ * @param indexes The new index of each instantiated item, or `-1` for items that are to be
+ * recycled. Retained items must remain in ascending order.
+ */
+static void updateItems(CollectionView *self, const ssize_t *indexes) {
+
+  resetPrefetching(self);
+
+  const Array *items = (Array *) self->items;
+
+  size_t first = SIZE_MAX, last = 0;
+  for (size_t i = 0; i < items->count; i++) {
+    if (indexes[i] == -1) {
+      enqueueReusableItem(self, items->elements[i], items->count);
+    } else {
+      first = min(first, (size_t) indexes[i]);
+      last = indexes[i] + 1;
+    }
+  }
+
+  if (first == SIZE_MAX) {
+    first = last = 0;
+  }
+
+  Array *updated = $$(Array, arrayWithCapacity, last - first);
+  assert(updated);
+
+  Theme *theme = self->contentView->window ? $$(Theme, theme, self->contentView->window) : NULL;
+
+  size_t j = 0;
+  for (size_t i = first; i < last; i++) {
+
+    while (j < items->count && indexes[j] == -1) {
+      j++;
+    }
+
+    CollectionItemView *item;
+    if (j < items->count && indexes[j] == (ssize_t) i) {
+      item = retain(items->elements[j++]);
+    } else {
+      item = createItem(self, i);
+
+      $(self->contentView, addSubview, (View *) item);
+
+      if (theme) {
+        $((View *) item, applyThemeIfNeeded, theme);
+      }
+    }
+
+    $(updated, addObject, item);
+    release(item);
+  }
+
+  release(self->items);
+  self->items = updated;
+  self->firstItem = first;
+
+  ((View *) self)->needsLayout = true;
+}
+
+/**
+ * @see View::layoutIfNeeded(View *)
+ */
+static void layoutIfNeeded(View *self) {
+
+  CollectionView *this = (CollectionView *) self;
+
+  size_t first, last;
+  visibleItems(this, &first, &last);
+
+  prefetchItems(this, first, last);
+
+  if (first != this->firstItem || last != this->firstItem + this->items->count) {
+    self->needsLayout = true;
+  }
+
+  super(View, self, layoutIfNeeded);
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -87,9 +639,32 @@ static void layoutSubviews(View *self) {
 
   super(View, self, layoutSubviews);
 
+  layoutVisibleItems(this);
+
   const SDL_Rect bounds = $((View *) this->scrollView, bounds);
 
-  int x = bounds.x, y = bounds.y;
+  const size_t perLine = itemsPerLine(this);
+  const size_t lines = (this->numberOfItems + perLine - 1) / perLine;
+
+  View *contentView = this->contentView;
+  switch (this->axis) {
+    case CollectionViewAxisVertical: {
+      const int h = bounds.y + (int) lines * (this->itemSize.h + this->itemSpacing.h);
+      if (contentView->minSize.h != h) {
+        contentView->minSize.h = h;
+        contentView->needsLayout = true;
+      }
+    }
+      break;
+    case CollectionViewAxisHorizontal: {
+      const int w = bounds.x + (int) lines * (this->itemSize.w + this->itemSpacing.w);
+      if (contentView->minSize.w != w) {
+        contentView->minSize.w = w;
+        contentView->needsLayout = true;
+      }
+    }
+      break;
+  }
 
   const Array *items = (Array *) this->items;
   for (size_t i = 0; i < items->count; i++) {
@@ -99,23 +674,19 @@ static void layoutSubviews(View *self) {
     $((View *) item, resize, &this->itemSize);
     $((View *) item, layoutIfNeeded);
 
-    item->view.frame.x = x;
-    item->view.frame.y = y;
+    const size_t index = this->firstItem + i;
+
+    const int line = (int) (index / perLine);
+    const int position = (int) (index % perLine);
 
     switch (this->axis) {
       case CollectionViewAxisVertical:
-        x += this->itemSize.w + this->itemSpacing.w;
-        if (x + this->itemSize.w > bounds.w) {
-          y += this->itemSize.h + this->itemSpacing.h;
-          x = bounds.x;
-        }
+        item->view.frame.x = bounds.x + position * (this->itemSize.w + this->itemSpacing.w);
+        item->view.frame.y = bounds.y + line * (this->itemSize.h + this->itemSpacing.h);
         break;
       case CollectionViewAxisHorizontal:
-        y += this->itemSize.h + this->itemSpacing.h;
-        if (y + this->itemSize.h > bounds.h) {
-          x += this->itemSize.w + this->itemSpacing.w;
-          y = bounds.y;
-        }
+        item->view.frame.x = bounds.x + line * (this->itemSize.w + this->itemSpacing.w);
+        item->view.frame.y = bounds.y + position * (this->itemSize.h + this->itemSpacing.h);
         break;
     }
   }
@@ -141,29 +712,34 @@ static bool captureEvent(Control *self, const SDL_Event *event) {
         };
 
         IndexPath *indexPath = $(this, indexPathForItemAtPoint, &point);
+        if (indexPath) {
 
-        const CollectionItemView *item = $(this, itemAtIndexPath, indexPath);
-        if (item) {
+          const bool isSelected = $(this, isItemSelectedAtIndexPath, indexPath);
 
           switch (self->selection) {
             case ControlSelectionNone:
               break;
             case ControlSelectionSingle:
-              if (item->isSelected == false) {
+              if (isSelected == false) {
                 $(this, deselectAll);
                 $(this, selectItemAtIndexPath, indexPath);
               }
               break;
             case ControlSelectionMultiple:
-              if (SDL_GetModState() & (SDL_KMOD_CTRL | SDL_KMOD_GUI)) {
-                if (item->isSelected) {
+              if ((SDL_GetModState() & SDL_KMOD_SHIFT) && this->selectionAnchor > -1) {
+                $(this, deselectAll);
+                selectItemsFromAnchor(this, $(indexPath, indexAtPosition, 0));
+              } else if (SDL_GetModState() & (SDL_KMOD_CTRL | SDL_KMOD_GUI)) {
+                if (isSelected) {
                   $(this, deselectItemAtIndexPath, indexPath);
                 } else {
                   $(this, selectItemAtIndexPath, indexPath);
                 }
+                this->selectionAnchor = $(indexPath, indexAtPosition, 0);
               } else {
                 $(this, deselectAll);
                 $(this, selectItemAtIndexPath, indexPath);
+                this->selectionAnchor = $(indexPath, indexAtPosition, 0);
               }
               break;
           }
@@ -195,11 +771,25 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
   $((CollectionItemView *) obj, setSelected, false);
 }
 
+/**
+ * @fn CollectionItemView *CollectionView::cloneItemPrototype(const CollectionView *self)
+ * @memberof CollectionView
+ */
+static CollectionItemView *cloneItemPrototype(const CollectionView *self) {
+
+  assert(self->itemPrototype);
+
+  return (CollectionItemView *) $((View *) self->itemPrototype, clone);
+}
+
 /**
  * @fn void CollectionView::deselectAll(CollectionView *self)
  * @memberof CollectionView
  */
 static void deselectAll(CollectionView *self) {
+
+  $(self->selectedItems, removeAllIndexes);
+
   $((Array *) self->items, enumerate, deselectAll_enumerate, NULL);
 }
 
@@ -210,19 +800,74 @@ static void deselectAll(CollectionView *self) {
 static void deselectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
   if (indexPath) {
-    CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
-    if (item) {
-      $(item, setSelected, false);
-      $(self->contentView, invalidateStyle);
+    const size_t index = $(indexPath, indexAtPosition, 0);
+    if ($(self->selectedItems, containsIndex, index)) {
+
+      $(self->selectedItems, removeIndex, index);
+
+      CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
+      if (item) {
+        $(item, setSelected, false);
+      }
     }
   }
 }
 
+/**
+ * @fn void CollectionView::deleteItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+ * @memberof CollectionView
+ */
+static void deleteItemsAtIndexPaths(CollectionView *self, const Array *indexPaths) {
+
+  if (indexPaths == NULL || indexPaths->count == 0) {
+    return;
+  }
+
+  size_t count;
+  size_t *indexes = indexesForIndexPaths(indexPaths, &count);
+
+  self->numberOfItems = self->dataSource.numberOfItems(self);
+
+  deleteSelectedItems(self, indexes, count);
+
+  const Array *items = (Array *) self->items;
+
+  ssize_t *mapped = malloc(items->count * sizeof(ssize_t));
+  assert(mapped || items->count == 0);
+
+  for (size_t i = 0; i < items->count; i++) {
+    mapped[i] = indexAfterDeletion(indexes, count, self->firstItem + i);
+  }
+
+  updateItems(self, mapped);
+
+  free(mapped);
+  free(indexes);
+}
+
+/**
+ * @fn CollectionItemView *CollectionView::dequeueReusableItem(const CollectionView *self)
+ * @memberof CollectionView
+ */
+static CollectionItemView *dequeueReusableItem(const CollectionView *self) {
+
+  Array *reusableItems = self->reusableItems;
+  if (reusableItems->count) {
+
+    CollectionItemView *item = retain($((Array *) reusableItems, lastObject));
+    $(reusableItems, removeObjectAtIndex, reusableItems->count - 1);
+
+    return item;
+  }
+
+  return NULL;
+}
+
 /**
  * @brief ArrayEnumerator for item deselection.
  */
 static void deselectItemsAtIndexPaths_enumerate(const Array *array, ident obj, ident data) {
-  $((CollectionItemView *) obj, setSelected, false);
+  $((CollectionView *) data, deselectItemAtIndexPath, (IndexPath *) obj);
 }
 
 /**
@@ -242,35 +887,44 @@ static void deselectItemsAtIndexPaths(CollectionView *self, const Array *indexPa
  */
 static IndexPath *indexPathForItemAtPoint(const CollectionView *self, const SDL_Point *point) {
 
-  if (self->itemSize.w && self->itemSize.h) {
+  const int itemWidth = self->itemSize.w + self->itemSpacing.w;
+  const int itemHeight = self->itemSize.h + self->itemSpacing.h;
 
-    const SDL_Rect frame = $(self->contentView, renderFrame);
+  if (itemWidth <= 0 || itemHeight <= 0) {
+    return NULL;
+  }
 
-    const int itemWidth = self->itemSize.w + self->itemSpacing.w;
-    const int itemHeight = self->itemSize.h + self->itemSpacing.h;
+  const SDL_Rect frame = $(self->contentView, renderFrame);
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
 
-    const int rows = max(1, frame.h / itemHeight);
-    const int cols = max(1, frame.w / itemWidth);
+  const int x = point->x - (frame.x + self->contentView->padding.left + bounds.x);
+  const int y = point->y - (frame.y + self->contentView->padding.top + bounds.y);
 
-    const int x = point->x - frame.x;
-    const int y = point->y - frame.y;
+  if (x < 0 || y < 0 || x % itemWidth >= self->itemSize.w || y % itemHeight >= self->itemSize.h) {
+    return NULL;
+  }
 
-    const int row = y / itemHeight;
-    const int col = x / itemWidth;
+  const size_t perLine = itemsPerLine(self);
 
-    int index;
-    switch (self->axis) {
-      case CollectionViewAxisVertical:
-        index = row * cols + col;
-        break;
-      case CollectionViewAxisHorizontal:
-        index = col * rows + row;
-        break;
-    }
+  size_t line, position;
+  switch (self->axis) {
+    case CollectionViewAxisVertical:
+      line = (size_t) (y / itemHeight);
+      position = (size_t) (x / itemWidth);
+      break;
+    case CollectionViewAxisHorizontal:
+      line = (size_t) (x / itemWidth);
+      position = (size_t) (y / itemHeight);
+      break;
+  }
 
-    if (index < (int) self->items->count) {
-      return $(alloc(IndexPath), initWithIndex, index);
-    }
+  if (position >= perLine) {
+    return NULL;
+  }
+
+  const size_t index = line * perLine + position;
+  if (index < self->numberOfItems) {
+    return $(alloc(IndexPath), initWithIndex, index);
   }
 
   return NULL;
@@ -284,7 +938,7 @@ static IndexPath *indexPathForItem(const CollectionView *self, const CollectionI
 
   const ssize_t index = $((Array *) self->items, indexOfObject, (ident) item);
   if (index > -1) {
-    return $(alloc(IndexPath), initWithIndex, index);
+    return $(alloc(IndexPath), initWithIndex, self->firstItem + index);
   }
 
   return NULL;
@@ -301,6 +955,14 @@ static CollectionView *initWithFrame(CollectionView *self, const SDL_Rect *frame
     self->items = $$(Array, array);
     assert(self->items);
 
+    self->reusableItems = $$(Array, array);
+    assert(self->reusableItems);
+
+    self->selectedItems = $(alloc(RangeSet), init);
+    assert(self->selectedItems);
+
+    self->selectionAnchor = -1;
+
     self->contentView = $(alloc(View), initWithFrame, NULL);
     assert(self->contentView);
 
@@ -327,14 +989,103 @@ static CollectionItemView *itemAtIndexPath(const CollectionView *self, const Ind
     const Array *items = (Array *) self->items;
     const size_t index = $(indexPath, indexAtPosition, 0);
 
-    if (index < items->count) {
-      return $(items, objectAtIndex, index);
+    if (index >= self->firstItem && index < self->firstItem + items->count) {
+      return $(items, objectAtIndex, index - self->firstItem);
     }
   }
 
   return NULL;
 }
 
+/**
+ * @fn void CollectionView::insertItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+ * @memberof CollectionView
+ */
+static void insertItemsAtIndexPaths(CollectionView *self, const Array *indexPaths) {
+
+  if (indexPaths == NULL || indexPaths->count == 0) {
+    return;
+  }
+
+  size_t count;
+  size_t *indexes = indexesForIndexPaths(indexPaths, &count);
+
+  self->numberOfItems = self->dataSource.numberOfItems(self);
+
+  insertSelectedItems(self, indexes, count);
+
+  const Array *items = (Array *) self->items;
+
+  ssize_t *mapped = malloc(items->count * sizeof(ssize_t));
+  assert(mapped || items->count == 0);
+
+  for (size_t i = 0; i < items->count; i++) {
+    mapped[i] = indexAfterInsertion(indexes, count, self->firstItem + i);
+  }
+
+  updateItems(self, mapped);
+
+  free(mapped);
+  free(indexes);
+}
+
+/**
+ * @fn bool CollectionView::isItemSelectedAtIndexPath(const CollectionView *self, const IndexPath *indexPath)
+ * @memberof CollectionView
+ */
+static bool isItemSelectedAtIndexPath(const CollectionView *self, const IndexPath *indexPath) {
+
+  if (indexPath) {
+    return $(self->selectedItems, containsIndex, $(indexPath, indexAtPosition, 0));
+  }
+
+  return false;
+}
+
+/**
+ * @fn void CollectionView::moveItemAtIndexPath(CollectionView *self, const IndexPath *from, const IndexPath *to)
+ * @memberof CollectionView
+ */
+static void moveItemAtIndexPath(CollectionView *self, const IndexPath *from, const IndexPath *to) {
+
+  assert(from);
+  assert(to);
+
+  const size_t a = $(from, indexAtPosition, 0);
+  const size_t b = $(to, indexAtPosition, 0);
+
+  if (a == b || a >= self->numberOfItems || b >= self->numberOfItems) {
+    return;
+  }
+
+  const bool isSelected = $(self->selectedItems, containsIndex, a);
+
+  $(self->selectedItems, deleteIndexesInRange, (Range) { .location = a, .length = 1 });
+  $(self->selectedItems, insertIndexesInRange, (Range) { .location = b, .length = 1 });
+
+  if (isSelected) {
+    $(self->selectedItems, addIndex, b);
+  }
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterMove(a, b, self->selectionAnchor);
+  }
+
+  const Array *items = (Array *) self->items;
+
+  ssize_t *mapped = malloc(items->count * sizeof(ssize_t));
+  assert(mapped || items->count == 0);
+
+  for (size_t i = 0; i < items->count; i++) {
+    const size_t item = self->firstItem + i;
+    mapped[i] = item == a ? -1 : (ssize_t) indexAfterMove(a, b, item);
+  }
+
+  updateItems(self, mapped);
+
+  free(mapped);
+}
+
 /**
  * @fn SDL_Size CollectionView::naturalSize(const CollectionView *self)
  * @memberof CollectionView
@@ -370,7 +1121,7 @@ static SDL_Size naturalSize(const CollectionView *self) {
         }
         w -= self->itemSpacing.w;
       }
-      const int rows = ceilf(self->items->count / (float) itemsPerRow);
+      const int rows = ceilf(self->numberOfItems / (float) itemsPerRow);
       size.w += max(self->itemSize.w, scrollViewSize.w);
       size.h += rows * (self->itemSize.h + self->itemSpacing.h);
     }
@@ -386,7 +1137,7 @@ static SDL_Size naturalSize(const CollectionView *self) {
         }
         h -= self->itemSpacing.h;
       }
-      const int cols = ceilf(self->items->count / (float) itemsPerCol);
+      const int cols = ceilf(self->numberOfItems / (float) itemsPerCol);
       size.w += cols * (self->itemSize.w + self->itemSpacing.w);
       size.h += max(self->itemSize.h, scrollViewSize.h);
     }
@@ -396,13 +1147,6 @@ static SDL_Size naturalSize(const CollectionView *self) {
   return size;
 }
 
-/**
- * @brief ArrayEnumerator to remove CollectionItemViews from the collection's contentView.
- */
-static void reloadData_removeItems(const Array *array, ident obj, ident data) {
-  $((View *) data, removeSubview, (View *) obj);
-}
-
 /**
  * @fn void CollectionView::reloadData(CollectionView *self)
  * @memberof CollectionView
@@ -412,22 +1156,59 @@ static void reloadData(CollectionView *self) {
   assert(self->dataSource.numberOfItems);
   assert(self->delegate.itemForObjectAtIndexPath);
 
-  $((Array *) self->items, enumerate, reloadData_removeItems, self->contentView);
+  const Array *items = (Array *) self->items;
+  for (size_t i = 0; i < items->count; i++) {
+    enqueueReusableItem(self, items->elements[i], items->count);
+  }
+
   $(self->items, removeAllObjects);
+  self->firstItem = 0;
 
-  const size_t numberOfItems = self->dataSource.numberOfItems(self);
-  for (size_t i = 0; i < numberOfItems; i++) {
+  self->numberOfItems = self->dataSource.numberOfItems(self);
 
-    IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
+  $(self->selectedItems, removeAllIndexes);
+  self->selectionAnchor = -1;
 
-    CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
-    assert(item);
+  resetPrefetching(self);
 
-    $(self->items, addObject, item);
-    $(self->contentView, addSubview, (View *) item);
+  ((View *) self)->needsLayout = true;
+}
 
-    release(item);
-    release(indexPath);
+/**
+ * @fn void CollectionView::reloadItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+ * @memberof CollectionView
+ */
+static void reloadItemsAtIndexPaths(CollectionView *self, const Array *indexPaths) {
+
+  if (indexPaths == NULL) {
+    return;
+  }
+
+  Theme *theme = self->contentView->window ? $$(Theme, theme, self->contentView->window) : NULL;
+
+  for (size_t i = 0; i < indexPaths->count; i++) {
+
+    const IndexPath *indexPath = indexPaths->elements[i];
+
+    CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
+    if (item) {
+
+      const size_t index = $(indexPath, indexAtPosition, 0);
+
+      enqueueReusableItem(self, item, self->items->count);
+      $(self->items, removeObjectAtIndex, index - self->firstItem);
+
+      item = createItem(self, index);
+
+      $(self->items, insertObjectAtIndex, item, index - self->firstItem);
+      $(self->contentView, addSubview, (View *) item);
+
+      if (theme) {
+        $((View *) item, applyThemeIfNeeded, theme);
+      }
+
+      release(item);
+    }
   }
 
   ((View *) self)->needsLayout = true;
@@ -445,6 +1226,10 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof CollectionView
  */
 static void selectAll(CollectionView *self) {
+
+  $(self->selectedItems, removeAllIndexes);
+  $(self->selectedItems, addIndexesInRange, (Range) { .location = 0, .length = self->numberOfItems });
+
   $((Array *) self->items, enumerate, selectAll_enumerate, NULL);
 }
 
@@ -454,15 +1239,16 @@ static void selectAll(CollectionView *self) {
  */
 static Array *selectionIndexPaths(const CollectionView *self) {
 
-  Array *array = $$(Array, array);
+  const RangeSet *selectedItems = self->selectedItems;
 
-  const Array *items = (Array *) self->items;
-  for (size_t i = 0; i < items->count; i++) {
+  Array *array = $$(Array, arrayWithCapacity, selectedItems->count);
+
+  for (size_t i = 0; i < selectedItems->numRanges; i++) {
 
-    const CollectionItemView *item = $(items, objectAtIndex, i);
-    if (item->isSelected) {
+    const Range range = selectedItems->ranges[i];
+    for (size_t j = 0; j < range.length; j++) {
 
-      IndexPath *indexPath = $(self, indexPathForItem, item);
+      IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, range.location + j);
       $(array, addObject, indexPath);
 
       release(indexPath);
@@ -479,10 +1265,15 @@ static Array *selectionIndexPaths(const CollectionView *self) {
 static void selectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
   if (indexPath) {
-    CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
-    if (item) {
-      $(item, setSelected, true);
-      $(self->contentView, invalidateStyle);
+    const size_t index = $(indexPath, indexAtPosition, 0);
+    if (index < self->numberOfItems) {
+
+      $(self->selectedItems, addIndex, index);
+
+      CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
+      if (item) {
+        $(item, setSelected, true);
+      }
     }
   }
 }
@@ -505,6 +1296,18 @@ static void selectItemsAtIndexPaths(CollectionView *self, const Array *indexPath
   }
 }
 
+/**
+ * @fn void CollectionView::setItemPrototype(CollectionView *self, CollectionItemView *prototype)
+ * @memberof CollectionView
+ */
+static void setItemPrototype(CollectionView *self, CollectionItemView *prototype) {
+
+  if (prototype != self->itemPrototype) {
+    release(self->itemPrototype);
+    self->itemPrototype = prototype ? retain(prototype) : NULL;
+  }
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -516,23 +1319,32 @@ static void initialize(Class *clazz) {
 
   ((ViewInterface *) clazz->interface)->applyStyle = applyStyle;
   ((ViewInterface *) clazz->interface)->init = init;
+  ((ViewInterface *) clazz->interface)->layoutIfNeeded = layoutIfNeeded;
   ((ViewInterface *) clazz->interface)->layoutSubviews = layoutSubviews;
 
   ((ControlInterface *) clazz->interface)->captureEvent = captureEvent;
 
+  ((CollectionViewInterface *) clazz->interface)->cloneItemPrototype = cloneItemPrototype;
+  ((CollectionViewInterface *) clazz->interface)->deleteItemsAtIndexPaths = deleteItemsAtIndexPaths;
+  ((CollectionViewInterface *) clazz->interface)->dequeueReusableItem = dequeueReusableItem;
   ((CollectionViewInterface *) clazz->interface)->deselectAll = deselectAll;
   ((CollectionViewInterface *) clazz->interface)->deselectItemAtIndexPath = deselectItemAtIndexPath;
   ((CollectionViewInterface *) clazz->interface)->deselectItemsAtIndexPaths = deselectItemsAtIndexPaths;
   ((CollectionViewInterface *) clazz->interface)->indexPathForItem = indexPathForItem;
   ((CollectionViewInterface *) clazz->interface)->indexPathForItemAtPoint = indexPathForItemAtPoint;
   ((CollectionViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
+  ((CollectionViewInterface *) clazz->interface)->insertItemsAtIndexPaths = insertItemsAtIndexPaths;
+  ((CollectionViewInterface *) clazz->interface)->isItemSelectedAtIndexPath = isItemSelectedAtIndexPath;
   ((CollectionViewInterface *) clazz->interface)->itemAtIndexPath = itemAtIndexPath;
+  ((CollectionViewInterface *) clazz->interface)->moveItemAtIndexPath = moveItemAtIndexPath;
   ((CollectionViewInterface *) clazz->interface)->naturalSize = naturalSize;
   ((CollectionViewInterface *) clazz->interface)->reloadData = reloadData;
+  ((CollectionViewInterface *) clazz->interface)->reloadItemsAtIndexPaths = reloadItemsAtIndexPaths;
   ((CollectionViewInterface *) clazz->interface)->selectAll = selectAll;
   ((CollectionViewInterface *) clazz->interface)->selectionIndexPaths = selectionIndexPaths;
   ((CollectionViewInterface *) clazz->interface)->selectItemAtIndexPath = selectItemAtIndexPath;
   ((CollectionViewInterface *) clazz->interface)->selectItemsAtIndexPaths = selectItemsAtIndexPaths;
+  ((CollectionViewInterface *) clazz->interface)->setItemPrototype = setItemPrototype;
 }
 
 /**
@@ -27,6 +27,7 @@
 
 #include <ObjectivelyMVC/Control.h>
 #include <ObjectivelyMVC/CollectionItemView.h>
+#include <ObjectivelyMVC/RangeSet.h>
 #include <ObjectivelyMVC/ScrollView.h>
 
 /**
@@ -80,6 +81,26 @@ struct CollectionViewDataSource {
    * @return The object for the item at the given index path.
    */
   ident (*objectForItemAtIndexPath)(const CollectionView *collectionView, const IndexPath *indexPath);
+
+  /**
+   * @brief Called by the CollectionView for items that are about to become visible.
+   * @param collectionView The CollectionView.
+   * @param indexPaths The index paths of the items.
+   * @remarks This function is optional. It is called while the CollectionView scrolls, for the
+   * items just beyond the visible region in the direction of scrolling. The faster the scrolling,
+   * the further ahead it reaches. Implementations may begin loading images for these items, so
+   * that they are ready when they become visible.
+   */
+  void (*prefetchItemsAtIndexPaths)(const CollectionView *collectionView, const Array *indexPaths);
+
+  /**
+   * @brief Called by the CollectionView for prefetched items that are no longer about to become
+   * visible, such as when scrolling reverses direction.
+   * @param collectionView The CollectionView.
+   * @param indexPaths The index paths of the items.
+   * @remarks This function is optional.
+   */
+  void (*cancelPrefetchingForItemsAtIndexPaths)(const CollectionView *collectionView, const Array *indexPaths);
 };
 
 /**
@@ -106,6 +127,8 @@ struct CollectionViewDelegate {
    * @param collectionView The CollectionView.
    * @param indexPath The index path.
    * @return The item for the index path.
+   * @remarks Items are only requested for the visible region of the CollectionView. Implementations
+   * should recycle items with CollectionView::dequeueReusableItem where possible.
    */
   CollectionItemView *(*itemForObjectAtIndexPath)(const CollectionView *collectionView, const IndexPath *indexPath);
 };
@@ -149,10 +172,23 @@ struct CollectionView {
   CollectionViewDelegate delegate;
 
   /**
-   * @brief The items.
+   * @brief The index of the first instantiated item.
+   * @private
+   */
+  size_t firstItem;
+
+  /**
+   * @brief The instantiated items, beginning with the item at `firstItem`.
+   * @remarks Only items in the visible region of the CollectionView are instantiated.
    */
   Array *items;
 
+  /**
+   * @brief An optional, fully styled item cloned for each item of this CollectionView.
+   * @see CollectionView::cloneItemPrototype(const CollectionView *)
+   */
+  CollectionItemView *itemPrototype;
+
   /**
    * @brief The item size.
    */
@@ -163,10 +199,48 @@ struct CollectionView {
    */
   SDL_Size itemSpacing;
 
+  /**
+   * @brief The number of items, as last reported by the data source.
+   * @private
+   */
+  size_t numberOfItems;
+
+  /**
+   * @brief The items passed to `prefetchItemsAtIndexPaths` which have been neither instantiated
+   * nor cancelled.
+   * @private
+   */
+  Range prefetchedItems;
+
+  /**
+   * @brief The scroll position at which items were last prefetched.
+   * @private
+   */
+  int prefetchOffset;
+
+  /**
+   * @brief Items that have left the visible region, available for reuse.
+   * @private
+   */
+  Array *reusableItems;
+
   /**
    * @brief The scroll view.
    */
   ScrollView *scrollView;
+
+  /**
+   * @brief The indexes of the selected items.
+   * @remarks Items query the selection as they are bound, so that items which are not
+   * instantiated may be selected as well.
+   */
+  RangeSet *selectedItems;
+
+  /**
+   * @brief The item from which shift-clicks extend the selection, or `-1`.
+   * @private
+   */
+  ssize_t selectionAnchor;
 };
 
 /**
@@ -179,6 +253,40 @@ struct CollectionViewInterface {
    */
   ControlInterface controlInterface;
 
+  /**
+   * @fn CollectionItemView *CollectionView::cloneItemPrototype(const CollectionView *self)
+   * @brief Clones the registered item prototype.
+   * @param self The CollectionView, which must have an item prototype.
+   * @return A new item, cloned from the item prototype.
+   * @remarks This is a convenience for CollectionViewDelegate::itemForObjectAtIndexPath
+   * implementations, which avoids loading and styling each item from scratch.
+   * @see CollectionView::setItemPrototype(CollectionView *, CollectionItemView *)
+   * @memberof CollectionView
+   */
+  CollectionItemView *(*cloneItemPrototype)(const CollectionView *self);
+
+  /**
+   * @fn void CollectionView::deleteItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+   * @brief Deletes the items at the specified index paths, which have already been removed from
+   * the data source.
+   * @param self The CollectionView.
+   * @param indexPaths The index paths of the deleted items, prior to deletion.
+   * @remarks Only the affected items are updated. The selection and scroll offset are preserved.
+   * @memberof CollectionView
+   */
+  void (*deleteItemsAtIndexPaths)(CollectionView *self, const Array *indexPaths);
+
+  /**
+   * @fn CollectionItemView *CollectionView::dequeueReusableItem(const CollectionView *self)
+   * @brief Dequeues an item that has left the visible region of this CollectionView.
+   * @param self The CollectionView.
+   * @return A retained item for reuse, or `NULL` if none are available.
+   * @remarks This is a convenience for CollectionViewDelegate::itemForObjectAtIndexPath
+   * implementations, which should only instantiate new items when this returns `NULL`.
+   * @memberof CollectionView
+   */
+  CollectionItemView *(*dequeueReusableItem)(const CollectionView *self);
+
   /**
    * @fn void CollectionView::deselectAll(CollectionView *self)
    * @brief Deselects all items in this CollectionView.
@@ -228,20 +336,52 @@ struct CollectionViewInterface {
    * @fn IndexPath CollectionView::indexPathForItemAtPoint(const CollectionView *self, const SDL_Point *point)
    * @param self The CollectionView.
    * @param point A point in window coordinate space.
-   * @return The index path of the item at the specified point, or `NULL`.
+   * @return The index path of the item at the specified point, or `NULL` if the point falls
+   * outside of every item, including the spacing between items.
    * @memberof CollectionView
    */
   IndexPath *(*indexPathForItemAtPoint)(const CollectionView *self, const SDL_Point *point);
 
+  /**
+   * @fn void CollectionView::insertItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+   * @brief Inserts items at the specified index paths, which have already been added to the data
+   * source.
+   * @param self The CollectionView.
+   * @param indexPaths The index paths of the inserted items, after insertion.
+   * @remarks Only the affected items are updated. The selection and scroll offset are preserved.
+   * @memberof CollectionView
+   */
+  void (*insertItemsAtIndexPaths)(CollectionView *self, const Array *indexPaths);
+
+  /**
+   * @fn bool CollectionView::isItemSelectedAtIndexPath(const CollectionView *self, const IndexPath *indexPath)
+   * @param self The CollectionView.
+   * @param indexPath An index path.
+   * @return True if the item at the specified index path is selected, false otherwise.
+   * @memberof CollectionView
+   */
+  bool (*isItemSelectedAtIndexPath)(const CollectionView *self, const IndexPath *indexPath);
+
   /**
    * @fn CollectionItemView *CollectionView::itemAtIndexPath(const CollectionView *self, const IndexPath *indexPath)
    * @param self The CollectionView.
    * @param indexPath An index path.
-   * @return The item at the specified index path, or `NULL`.
+   * @return The item at the specified index path, or `NULL` if it is not instantiated.
    * @memberof CollectionView
    */
   CollectionItemView *(*itemAtIndexPath)(const CollectionView *self, const IndexPath *indexPath);
 
+  /**
+   * @fn void CollectionView::moveItemAtIndexPath(CollectionView *self, const IndexPath *from, const IndexPath *to)
+   * @brief Moves the item at `from` to `to`, where it has already been moved in the data source.
+   * @param self The CollectionView.
+   * @param from The index path of the item prior to the move.
+   * @param to The index path of the item after the move.
+   * @remarks The selection and scroll offset are preserved.
+   * @memberof CollectionView
+   */
+  void (*moveItemAtIndexPath)(CollectionView *self, const IndexPath *from, const IndexPath *to);
+
   /**
    * @fn SDL_Size CollectionView::naturalSize(const CollectionView *self)
    * @param self The CollectionView.
@@ -255,11 +395,22 @@ struct CollectionViewInterface {
    * @brief Reloads this CollectionView's visible items.
    * @param self The CollectionView.
    * @remarks This method must be called after changes to the data source or delegate. Failure to
-   * call this method after such changes leads to undefined behavior.
+   * call this method after such changes leads to undefined behavior. Instantiated items are made
+   * available for reuse, and the selection is cleared.
    * @memberof CollectionView
    */
   void (*reloadData)(CollectionView *self);
 
+  /**
+   * @fn void CollectionView::reloadItemsAtIndexPaths(CollectionView *self, const Array *indexPaths)
+   * @brief Reloads the items at the specified index paths.
+   * @param self The CollectionView.
+   * @param indexPaths The index paths of the items to reload.
+   * @remarks Items that are not instantiated are not requested from the delegate.
+   * @memberof CollectionView
+   */
+  void (*reloadItemsAtIndexPaths)(CollectionView *self, const Array *indexPaths);
+
   /**
    * @fn void CollectionView::selectAll(CollectionView *self)
    * @brief Selects all items in this CollectionView.
@@ -293,6 +444,15 @@ struct CollectionViewInterface {
    * @memberof CollectionView
    */
   void (*selectItemsAtIndexPaths)(CollectionView *self, const Array *indexPaths);
+
+  /**
+   * @fn void CollectionView::setItemPrototype(CollectionView *self, CollectionItemView *prototype)
+   * @brief Registers the item prototype for this CollectionView.
+   * @param self The CollectionView.
+   * @param prototype The item prototype, or `NULL`.
+   * @memberof CollectionView
+   */
+  void (*setItemPrototype)(CollectionView *self, CollectionItemView *prototype);
 };
 
 /**
@@ -0,0 +1,262 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include "CompiledData.h"
+#include "Log.h"
+
+void MVC_WriteCompiledInteger(MutableData *data, uint32_t value) {
+
+  const uint8_t bytes[] = {
+    value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff
+  };
+
+  $(data, appendBytes, bytes, sizeof(bytes));
+}
+
+void MVC_WriteCompiledString(MutableData *data, const char *chars) {
+
+  const size_t length = strlen(chars);
+
+  MVC_WriteCompiledInteger(data, (uint32_t) length);
+  $(data, appendBytes, (const uint8_t *) chars, length + 1);
+}
+
+/**
+ * @brief Appends the string `string` to `data`, in place or by reference to `table`.
+ */
+static void writeString(MutableData *data, CompiledStringTable *table, const String *string) {
+
+  if (table) {
+    MVC_WriteCompiledInteger(data, MVC_CompiledStringIndex(table, string));
+  } else {
+    MVC_WriteCompiledString(data, string->chars);
+  }
+}
+
+void MVC_WriteCompiledValue(MutableData *data, CompiledStringTable *table, const Object *obj) {
+
+  if ($(obj, isKindOfClass, _Boole())) {
+    MVC_WriteCompiledInteger(data, CompiledValueBoole);
+    MVC_WriteCompiledInteger(data, ((Boole *) obj)->value);
+  } else if ($(obj, isKindOfClass, _Number())) {
+    const double value = ((Number *) obj)->value;
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    MVC_WriteCompiledInteger(data, CompiledValueNumber);
+    MVC_WriteCompiledInteger(data, (uint32_t) bits);
+    MVC_WriteCompiledInteger(data, (uint32_t) (bits >> 32));
+  } else if ($(obj, isKindOfClass, _String())) {
+    MVC_WriteCompiledInteger(data, CompiledValueString);
+    writeString(data, table, (String *) obj);
+  } else if ($(obj, isKindOfClass, _Array())) {
+    const Array *array = (Array *) obj;
+    MVC_WriteCompiledInteger(data, CompiledValueArray);
+    MVC_WriteCompiledInteger(data, (uint32_t) array->count);
+    for (size_t i = 0; i < array->count; i++) {
+      MVC_WriteCompiledValue(data, table, array->elements[i]);
+    }
+  } else if ($(obj, isKindOfClass, _Dictionary())) {
+    const Dictionary *dictionary = (Dictionary *) obj;
+
+    Array *keys = MVC_CompiledKeys(dictionary);
+
+    MVC_WriteCompiledInteger(data, CompiledValueDictionary);
+    MVC_WriteCompiledInteger(data, (uint32_t) keys->count);
+    for (size_t i = 0; i < keys->count; i++) {
+
+      const String *key = keys->elements[i];
+      writeString(data, table, key);
+      MVC_WriteCompiledValue(data, table, $(dictionary, objectForKey, (ident) key));
+    }
+
+    release(keys);
+  } else {
+    if (!$(obj, isKindOfClass, _Null())) {
+      SDL_LogWarn(LOG_CATEGORY_MVC, "%s: Unsupported value: %s\n", __func__, obj->clazz->def.name);
+    }
+    MVC_WriteCompiledInteger(data, CompiledValueNull);
+  }
+}
+
+uint32_t MVC_CompiledStringIndex(CompiledStringTable *table, const String *string) {
+
+  const Number *index = $(table->indexes, objectForKey, (ident) string);
+  if (index) {
+    return (uint32_t) index->value;
+  }
+
+  Number *number = $$(Number, numberWithValue, table->strings->count);
+  assert(number);
+
+  $(table->indexes, setObjectForKey, number, (ident) string);
+  $(table->strings, addObject, (ident) string);
+
+  release(number);
+
+  return (uint32_t) table->strings->count - 1;
+}
+
+/**
+ * @brief Comparator for key sorting.
+ */
+static Order keysComparator(const ident a, const ident b) {
+  return $((String *) a, compareTo, (String *) b);
+}
+
+Array *MVC_CompiledKeys(const Dictionary *dictionary) {
+
+  Array *keys = $(dictionary, allKeys);
+  assert(keys);
+
+  Array *sortedKeys = $(keys, sortedArray, keysComparator);
+  assert(sortedKeys);
+
+  release(keys);
+  return sortedKeys;
+}
+
+uint32_t MVC_ReadCompiledInteger(CompiledReader *reader) {
+
+  if (reader->end - reader->bytes < 4) {
+    reader->error = true;
+    return 0;
+  }
+
+  const uint8_t *b = reader->bytes;
+  reader->bytes += 4;
+
+  return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t) b[3] << 24);
+}
+
+uint32_t MVC_ReadCompiledCount(CompiledReader *reader) {
+
+  const uint32_t count = MVC_ReadCompiledInteger(reader);
+  if (count > (size_t) (reader->end - reader->bytes) / 4) {
+    reader->error = true;
+    return 0;
+  }
+
+  return count;
+}
+
+const char *MVC_ReadCompiledString(CompiledReader *reader) {
+
+  const uint32_t length = MVC_ReadCompiledInteger(reader);
+  if (reader->error || (size_t) (reader->end - reader->bytes) <= length || reader->bytes[length]) {
+    reader->error = true;
+    return "";
+  }
+
+  const char *chars = (const char *) reader->bytes;
+  reader->bytes += length + 1;
+
+  return chars;
+}
+
+/**
+ * @return A String at the read position, in place or by reference to the string table, or `NULL`
+ * on error. The String is retained.
+ */
+static String *readString(CompiledReader *reader) {
+
+  if (reader->strings == NULL) {
+    const char *chars = MVC_ReadCompiledString(reader);
+    return reader->error ? NULL : $$(String, stringWithCharacters, chars);
+  }
+
+  const uint32_t index = MVC_ReadCompiledInteger(reader);
+  if (reader->error || index >= reader->strings->count) {
+    reader->error = true;
+    return NULL;
+  }
+
+  return retain(reader->strings->elements[index]);
+}
+
+ident MVC_ReadCompiledValue(CompiledReader *reader) {
+
+  switch (MVC_ReadCompiledInteger(reader)) {
+    case CompiledValueNull:
+      return retain($$(Null, null));
+
+    case CompiledValueBoole:
+      return retain(MVC_ReadCompiledInteger(reader) ? $$(Boole, True) : $$(Boole, False));
+
+    case CompiledValueNumber: {
+      const uint64_t lo = MVC_ReadCompiledInteger(reader);
+      const uint64_t hi = MVC_ReadCompiledInteger(reader);
+      const uint64_t bits = lo | (hi << 32);
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+      return $$(Number, numberWithValue, value);
+    }
+
+    case CompiledValueString:
+      return readString(reader);
+
+    case CompiledValueArray: {
+      const uint32_t count = MVC_ReadCompiledCount(reader);
+
+      Array *array = $$(Array, arrayWithCapacity, count);
+      assert(array);
+
+      for (uint32_t i = 0; i < count && !reader->error; i++) {
+        ident obj = MVC_ReadCompiledValue(reader);
+        if (obj) {
+          $(array, addObject, obj);
+          release(obj);
+        }
+      }
+
+      return array;
+    }
+
+    case CompiledValueDictionary: {
+      const uint32_t count = MVC_ReadCompiledCount(reader);
+
+      Dictionary *dictionary = $$(Dictionary, dictionaryWithCapacity, count);
+      assert(dictionary);
+
+      for (uint32_t i = 0; i < count && !reader->error; i++) {
+        String *key = readString(reader);
+        ident obj = MVC_ReadCompiledValue(reader);
+        if (key && obj) {
+          $(dictionary, setObjectForKey, obj, key);
+        }
+        release(obj);
+        release(key);
+      }
+
+      return dictionary;
+    }
+
+    default:
+      reader->error = true;
+      return NULL;
+  }
+}
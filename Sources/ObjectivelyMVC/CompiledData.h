@@ -0,0 +1,128 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+#include <Objectively/MutableData.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ * @brief The little-endian binary encoding shared by compiled Stylesheets and ViewTemplates.
+ * @remarks This header is private to ObjectivelyMVC, and is not installed.
+ */
+
+/**
+ * @brief The tags of compiled values.
+ */
+typedef enum {
+  CompiledValueNull,
+  CompiledValueBoole,
+  CompiledValueNumber,
+  CompiledValueString,
+  CompiledValueArray,
+  CompiledValueDictionary,
+} CompiledValue;
+
+/**
+ * @brief The string table of Data being compiled.
+ * @remarks Keys and class names repeat throughout most layouts, so each distinct string is
+ * written once and referenced by its index.
+ */
+typedef struct {
+  Dictionary *indexes;
+  Array *strings;
+} CompiledStringTable;
+
+/**
+ * @brief A bounds-checked cursor over compiled Data.
+ */
+typedef struct {
+  const uint8_t *bytes, *end;
+
+  /**
+   * @brief The string table, or `NULL` if strings are written in place.
+   */
+  const Array *strings;
+
+  bool error;
+} CompiledReader;
+
+/**
+ * @brief Appends the little-endian 32 bit integer `value` to `data`.
+ */
+void MVC_WriteCompiledInteger(MutableData *data, uint32_t value);
+
+/**
+ * @brief Appends the length-prefixed, null-terminated string `chars` to `data`.
+ * @remarks The null terminator allows the reader to use strings in place.
+ */
+void MVC_WriteCompiledString(MutableData *data, const char *chars);
+
+/**
+ * @brief Appends the tagged value `obj` to `data`.
+ * @param table The string table to which strings are added, or `NULL` to write them in place.
+ */
+void MVC_WriteCompiledValue(MutableData *data, CompiledStringTable *table, const Object *obj);
+
+/**
+ * @return The index of `string` in `table`, adding it if necessary.
+ */
+uint32_t MVC_CompiledStringIndex(CompiledStringTable *table, const String *string);
+
+/**
+ * @return A new Array of the keys of `dictionary`, sorted so that compiled Data is reproducible.
+ */
+Array *MVC_CompiledKeys(const Dictionary *dictionary);
+
+/**
+ * @return The little-endian 32 bit integer at the read position.
+ */
+uint32_t MVC_ReadCompiledInteger(CompiledReader *reader);
+
+/**
+ * @return A count at the read position, which must not exceed the remaining Data.
+ * @remarks Every counted element occupies at least four bytes, so larger counts are malformed.
+ */
+uint32_t MVC_ReadCompiledCount(CompiledReader *reader);
+
+/**
+ * @return The null-terminated string at the read position, which is not copied.
+ */
+const char *MVC_ReadCompiledString(CompiledReader *reader);
+
+/**
+ * @return The tagged value at the read position, or `NULL` on error.
+ */
+ident MVC_ReadCompiledValue(CompiledReader *reader);
+
+/**
+ * @param sourceHash Receives the hash of the stylesheet.css from which it was compiled.
+ * @return The compiled default Stylesheet embedded at build time, or `NULL` if none was embedded.
+ */
+Data *MVC_CompiledDefaultStylesheet(int *sourceHash);
@@ -45,6 +45,19 @@ const EnumName ControlStateNames[] = MakeEnumNames(
   MakeEnumAlias(ControlStateDisabled, disabled)
 );
 
+/**
+ * @brief The pseudo-classes that depend on ControlState bits.
+ */
+static const struct {
+  ControlState state;
+  const char *pseudoClass;
+} _pseudoClasses[] = {
+  { ControlStateDisabled, "disabled" },
+  { ControlStateFocused, "focused" },
+  { ControlStateHighlighted, "highlighted" },
+  { ControlStateSelected, "selected" },
+};
+
 #define _Class _Control
 
 #pragma mark - Object
@@ -92,12 +105,23 @@ static void applyStyle(View *self, const Style *style) {
 
   Control *this = (Control *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("bevel", InletTypeEnum, &this->bevel, (ident) ControlBevelNames),
-    MakeInlet("selection", InletTypeEnum, &this->selection, (ident) ControlSelectionNames)
-  );
+  for (size_t i = 0; i < style->numValues; i++) {
 
-  $(self, bind, inlets, (Dictionary *) style->attributes);
+    StyleValue *value = style->values[i];
+
+    switch (value->property) {
+      case StylePropertyBevel:
+        $(value, bind, InletTypeEnum, &this->bevel, (ident) ControlBevelNames);
+        break;
+      case StylePropertySelection:
+        $(value, bind, InletTypeEnum, &this->selection, (ident) ControlSelectionNames);
+        break;
+      default:
+        continue;
+    }
+
+    self->needsLayout = true;
+  }
 }
 
 /**
@@ -117,6 +141,21 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
   $(self, bind, inlets, dictionary);
 }
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  Control *this = (Control *) self;
+  const Control *that = (Control *) prototype;
+
+  this->bevel = that->bevel;
+  this->selection = that->selection;
+  this->state = that->state;
+}
+
 /**
  * @see View::init(View *)
  */
@@ -152,18 +191,21 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
 
   switch (simpleSelector->type) {
     case SimpleSelectorTypePseudo:
-      if (strcmp("highlighted", simpleSelector->pattern) == 0) {
-        return $(this, isHighlighted);
-      } else if (strcmp("disabled", simpleSelector->pattern) == 0) {
-        return $(this, isDisabled);
-      } else if (strcmp("selected", simpleSelector->pattern) == 0) {
-        return $(this, isSelected);
-      } else if (strcmp("focused", simpleSelector->pattern) == 0) {
-        return $(this, isFocused);
-      } else if (strcmp("single", simpleSelector->pattern) == 0) {
-        return this->selection == ControlSelectionSingle;
-      } else if (strcmp("multiple", simpleSelector->pattern) == 0) {
-        return this->selection == ControlSelectionMultiple;
+      switch (simpleSelector->pseudoClass) {
+        case PseudoClassHighlighted:
+          return $(this, isHighlighted);
+        case PseudoClassDisabled:
+          return $(this, isDisabled);
+        case PseudoClassSelected:
+          return $(this, isSelected);
+        case PseudoClassFocused:
+          return $(this, isFocused);
+        case PseudoClassSingle:
+          return this->selection == ControlSelectionSingle;
+        case PseudoClassMultiple:
+          return this->selection == ControlSelectionMultiple;
+        default:
+          break;
       }
       break;
     default:
@@ -350,7 +392,14 @@ static void stateDidChange(Control *self) {
     $(this, emitViewEvent, ViewEventBlur, NULL);
   }
 
-  $(this, invalidateStyle);
+  const unsigned int changed = self->state ^ self->styledState;
+  self->styledState = self->state;
+
+  for (size_t i = 0; i < lengthof(_pseudoClasses); i++) {
+    if (changed & _pseudoClasses[i].state) {
+      $(this, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, _pseudoClasses[i].pseudoClass);
+    }
+  }
 
   this->needsLayout = true;
 }
@@ -368,6 +417,7 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->acceptsTouchResponder = acceptsTouchResponder;
   ((ViewInterface *) clazz->interface)->applyStyle = applyStyle;
   ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
   ((ViewInterface *) clazz->interface)->becomeKeyResponder = becomeKeyResponder;
   ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->matchesSelector = matchesSelector;
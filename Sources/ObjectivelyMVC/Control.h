@@ -103,6 +103,12 @@ struct Control {
    */
   unsigned int state;
 
+  /**
+   * @brief The bit mask of ControlState last seen by Control::stateDidChange.
+   * @private
+   */
+  unsigned int styledState;
+
   /**
    * @brief The ControlSelection.
    */
@@ -306,7 +306,10 @@ static void debug(DebugViewController *self, const View *view, Renderer *rendere
   self->frames++;
   if (SDL_GetTicks() - self->timestamp >= 1000) {
 
-    $(self->statistics, setTextWithFormat, "%d views, %dfps", self->visibleViews, self->frames);
+    $(self->statistics, setTextWithFormat, "%d views, %dfps, %.1fMB textures",
+      self->visibleViews,
+      self->frames,
+      renderer->textureMemory / (1024.0 * 1024.0));
 
     self->timestamp = SDL_GetTicks();
     self->frames = 0;
@@ -0,0 +1,116 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+#include <Objectively/Hash.h>
+
+#include "CompiledData.h"
+#include "Stylesheet.h"
+
+/**
+ * @file
+ * @brief The compiled default Stylesheet, embedded so that it need not be parsed at startup.
+ * @details The library is built with `HAVE_COMPILED_STYLESHEET`, once the bootstrap compiler,
+ * built from this file with `MVC_STYLESHEET_BOOTSTRAP`, has generated stylesheet.cssb.h.
+ */
+
+#if HAVE_COMPILED_STYLESHEET
+#include "../Assets/stylesheet.cssb.h"
+#endif
+
+Data *MVC_CompiledDefaultStylesheet(int *sourceHash) {
+
+#if HAVE_COMPILED_STYLESHEET
+  *sourceHash = stylesheet_cssb_source_hash;
+  return $$(Data, dataWithConstMemory, (ident) stylesheet_cssb, stylesheet_cssb_len);
+#else
+  *sourceHash = 0;
+  return NULL;
+#endif
+}
+
+#if MVC_STYLESHEET_BOOTSTRAP
+
+/**
+ * @brief Compiles stylesheet.css, and writes it as a C header along with the hash of its source.
+ * @details Usage: `stylesheetc-bootstrap stylesheet.css stylesheet.cssb.h`
+ */
+int main(int argc, char **argv) {
+
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s stylesheet.css stylesheet.cssb.h\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const char *input = argv[1];
+  const char *output = argv[2];
+
+  Data *css = $$(Data, dataWithContentsOfFile, input);
+  if (css == NULL) {
+    fprintf(stderr, "%s: Failed to read %s\n", argv[0], input);
+    return EXIT_FAILURE;
+  }
+
+  Stylesheet *stylesheet = $$(Stylesheet, stylesheetWithData, css);
+  if (stylesheet == NULL) {
+    fprintf(stderr, "%s: Failed to parse %s\n", argv[0], input);
+    release(css);
+    return EXIT_FAILURE;
+  }
+
+  Data *data = $(stylesheet, compiledData);
+
+  bool written = false;
+
+  FILE *file = fopen(output, "w");
+  if (file) {
+    fprintf(file, "static const unsigned char stylesheet_cssb[] = {");
+    for (size_t i = 0; i < data->length; i++) {
+      fprintf(file, "%s0x%02x,", i % 12 ? " " : "\n  ", data->bytes[i]);
+    }
+    fprintf(file, "\n};\n");
+
+    fprintf(file, "static const unsigned int stylesheet_cssb_len = %zu;\n", data->length);
+    fprintf(file, "static const int stylesheet_cssb_source_hash = %d;\n",
+            HashForBytes(HASH_SEED, css->bytes, (Range) { .location = 0, .length = css->length }));
+
+    written = ferror(file) == 0;
+    written = fclose(file) == 0 && written;
+  }
+
+  if (written == false) {
+    fprintf(stderr, "%s: Failed to write %s\n", argv[0], output);
+    remove(output);
+  }
+
+  release(data);
+  release(stylesheet);
+  release(css);
+
+  return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif
@@ -16,15 +16,56 @@
  */
 
 #include <assert.h>
+#include <stdint.h>
 #include <string.h>
 
+#include <SDL3/SDL_atomic.h>
 #include <SDL3_image/SDL_image.h>
 
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+#include <Objectively/String.h>
+
 #include "Image.h"
 #include "Log.h"
 
 #define _Class _Image
 
+/**
+ * @brief The Image cache, keyed by Resource name.
+ */
+static Dictionary *_cache;
+
+/**
+ * @brief The size in bytes of the decoded surfaces in the Image cache.
+ */
+static size_t _cacheSize;
+
+/**
+ * @brief The Image cache lock, so that Images may be loaded from any thread.
+ */
+static SDL_SpinLock _cacheLock;
+
+/**
+ * @brief The most recently assigned Image serial number.
+ */
+static SDL_AtomicInt _serial;
+
+/**
+ * @brief The serial numbers of the most recently deallocated Images.
+ */
+static int _freedSerials[IMAGE_FREED_SERIALS];
+
+/**
+ * @brief The number of Images deallocated.
+ */
+static Uint64 _freedCount;
+
+/**
+ * @brief The deallocated serial numbers lock.
+ */
+static SDL_SpinLock _freedLock;
+
 #pragma mark - Object
 
 /**
@@ -36,11 +77,94 @@ static void dealloc(Object *self) {
 
   SDL_DestroySurface(this->surface);
 
+  SDL_LockSpinlock(&_freedLock);
+  _freedSerials[_freedCount++ % IMAGE_FREED_SERIALS] = this->serial;
+  SDL_UnlockSpinlock(&_freedLock);
+
   super(Object, self, dealloc);
 }
 
 #pragma mark - Image
 
+/**
+ * @return The size in bytes of the decoded surface of `image`.
+ */
+static size_t sizeOfImage(const Image *image) {
+  return image->surface ? (size_t) image->surface->pitch * image->surface->h : 0;
+}
+
+/**
+ * @brief Evicts Images referenced only by the cache, until the cache fits within `budget`.
+ * @return The evicted Images, or `NULL`. The caller must release these after unlocking the
+ * cache, so that their surfaces are not freed while the lock is held.
+ * @remarks The cache lock must be held.
+ */
+static Array *evictImages(size_t budget) {
+
+  if (_cacheSize <= budget) {
+    return NULL;
+  }
+
+  Array *evicted = $$(Array, array);
+  assert(evicted);
+
+  Array *keys = $(_cache, allKeys);
+  assert(keys);
+
+  for (size_t i = 0; i < keys->count && _cacheSize > budget; i++) {
+
+    Image *image = $(_cache, objectForKey, keys->elements[i]);
+    if (image->object.referenceCount == 1) {
+      _cacheSize -= sizeOfImage(image);
+      $(evicted, addObject, image);
+      $(_cache, removeObjectForKey, keys->elements[i]);
+    }
+  }
+
+  release(keys);
+  return evicted;
+}
+
+/**
+ * @fn void Image::clearCache(void)
+ * @memberof Image
+ */
+static void clearCache(void) {
+
+  SDL_LockSpinlock(&_cacheLock);
+
+  Array *evicted = evictImages(0);
+
+  SDL_UnlockSpinlock(&_cacheLock);
+
+  release(evicted);
+}
+
+/**
+ * @fn size_t Image::freedSerials(Uint64 *cursor, int *serials, size_t count)
+ * @memberof Image
+ */
+static size_t freedSerials(Uint64 *cursor, int *serials, size_t count) {
+
+  assert(cursor);
+  assert(serials);
+
+  SDL_LockSpinlock(&_freedLock);
+
+  if (_freedCount - *cursor > IMAGE_FREED_SERIALS) {
+    *cursor = _freedCount - IMAGE_FREED_SERIALS;
+  }
+
+  size_t i = 0;
+  while (i < count && *cursor < _freedCount) {
+    serials[i++] = _freedSerials[(*cursor)++ % IMAGE_FREED_SERIALS];
+  }
+
+  SDL_UnlockSpinlock(&_freedLock);
+
+  return i;
+}
+
 /**
  * @fn Image *Image::imageWithBytes(const uint8_t *bytes, size_t length)
  * @memberof Image
@@ -141,12 +265,58 @@ static Image *initWithResource(Image *self, const Resource *resource) {
  */
 static Image *initWithResourceName(Image *self, const char *name) {
 
+  assert(name);
+
+  String *key = $$(String, stringWithCharacters, name);
+  assert(key);
+
+  SDL_LockSpinlock(&_cacheLock);
+
+  Image *image = $(_cache, objectForKey, key);
+  if (image) {
+    retain(image);
+  }
+
+  SDL_UnlockSpinlock(&_cacheLock);
+
+  if (image) {
+    release(self);
+    release(key);
+    return image;
+  }
+
   Resource *resource = $$(Resource, resourceWithName, name);
 
   self = $(self, initWithResource, resource);
 
   release(resource);
 
+  if (self) {
+    Array *evicted = NULL;
+
+    SDL_LockSpinlock(&_cacheLock);
+
+    image = $(_cache, objectForKey, key);
+    if (image) {
+      image = retain(image);
+    } else {
+      $(_cache, setObjectForKey, self, key);
+      _cacheSize += sizeOfImage(self);
+
+      evicted = evictImages(IMAGE_CACHE_BUDGET);
+    }
+
+    SDL_UnlockSpinlock(&_cacheLock);
+
+    release(evicted);
+
+    if (image) {
+      release(self);
+      self = image;
+    }
+  }
+
+  release(key);
   return self;
 }
 
@@ -159,6 +329,8 @@ static Image *initWithSurface(Image *self, SDL_Surface *surface) {
   self = (Image *) super(Object, self, init);
   if (self) {
 
+    self->serial = SDL_AddAtomicInt(&_serial, 1) + 1;
+
     if (surface) {
       if (surface->format != SDL_PIXELFORMAT_RGBA32) {
         self->surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
@@ -174,6 +346,68 @@ static Image *initWithSurface(Image *self, SDL_Surface *surface) {
   return self;
 }
 
+/**
+ * @fn Image *Image::scaledImage(const Image *self, const SDL_Size *size)
+ * @memberof Image
+ */
+static Image *scaledImage(const Image *self, const SDL_Size *size) {
+
+  assert(size);
+
+  const SDL_Surface *src = self->surface;
+
+  if (size->w < 1 || size->h < 1 || size->w > src->w || size->h > src->h) {
+    MVC_LogError("Invalid size %dx%d for %dx%d Image\n", size->w, size->h, src->w, src->h);
+    return NULL;
+  }
+
+  SDL_Surface *dst = SDL_CreateSurface(size->w, size->h, SDL_PIXELFORMAT_RGBA32);
+  if (dst == NULL) {
+    MVC_LogError("%s\n", SDL_GetError());
+    return NULL;
+  }
+
+  for (int y = 0; y < dst->h; y++) {
+
+    const int y0 = (int) ((int64_t) y * src->h / dst->h);
+    const int y1 = SDL_max(y0 + 1, (int) ((int64_t) (y + 1) * src->h / dst->h));
+
+    uint8_t *out = (uint8_t *) dst->pixels + y * dst->pitch;
+
+    for (int x = 0; x < dst->w; x++, out += 4) {
+
+      const int x0 = (int) ((int64_t) x * src->w / dst->w);
+      const int x1 = SDL_max(x0 + 1, (int) ((int64_t) (x + 1) * src->w / dst->w));
+
+      uint64_t r = 0, g = 0, b = 0, a = 0;
+
+      for (int sy = y0; sy < y1; sy++) {
+
+        const uint8_t *in = (const uint8_t *) src->pixels + sy * src->pitch + x0 * 4;
+
+        for (int sx = x0; sx < x1; sx++, in += 4) {
+          r += in[0] * in[3];
+          g += in[1] * in[3];
+          b += in[2] * in[3];
+          a += in[3];
+        }
+      }
+
+      const uint64_t count = (uint64_t) (x1 - x0) * (y1 - y0);
+
+      out[0] = a ? (uint8_t) (r / a) : 0;
+      out[1] = a ? (uint8_t) (g / a) : 0;
+      out[2] = a ? (uint8_t) (b / a) : 0;
+      out[3] = (uint8_t) ((a + count / 2) / count);
+    }
+  }
+
+  Image *image = $(alloc(Image), initWithSurface, dst);
+
+  SDL_DestroySurface(dst);
+  return image;
+}
+
 /**
  * @fn SDL_Size Image::size(const Image *self)
  * @memberof Image
@@ -191,6 +425,8 @@ static void initialize(Class *clazz) {
 
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
+  ((ImageInterface *) clazz->interface)->clearCache = clearCache;
+  ((ImageInterface *) clazz->interface)->freedSerials = freedSerials;
   ((ImageInterface *) clazz->interface)->imageWithBytes = imageWithBytes;
   ((ImageInterface *) clazz->interface)->imageWithData = imageWithData;
   ((ImageInterface *) clazz->interface)->imageWithResource = imageWithResource;
@@ -201,7 +437,18 @@ static void initialize(Class *clazz) {
   ((ImageInterface *) clazz->interface)->initWithResource = initWithResource;
   ((ImageInterface *) clazz->interface)->initWithResourceName = initWithResourceName;
   ((ImageInterface *) clazz->interface)->initWithSurface = initWithSurface;
+  ((ImageInterface *) clazz->interface)->scaledImage = scaledImage;
   ((ImageInterface *) clazz->interface)->size = size;
+
+  _cache = $$(Dictionary, dictionary);
+  assert(_cache);
+}
+
+/**
+ * @see Class::destroy(Class *)
+ */
+static void destroy(Class *clazz) {
+  release(_cache);
 }
 
 /**
@@ -220,6 +467,7 @@ Class *_Image(void) {
       .interfaceOffset = offsetof(Image, interface),
       .interfaceSize = sizeof(ImageInterface),
       .initialize = initialize,
+      .destroy = destroy,
     });
   });
 
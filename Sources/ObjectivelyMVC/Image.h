@@ -28,6 +28,17 @@
  * @brief Image loading.
  */
 
+/**
+ * @brief The size in bytes of decoded surfaces that the Image cache retains while unreferenced.
+ * @remarks Images in use are never evicted, regardless of this budget.
+ */
+#define IMAGE_CACHE_BUDGET (32 * 1024 * 1024)
+
+/**
+ * @brief The number of deallocated Image serial numbers retained for `Image::freedSerials`.
+ */
+#define IMAGE_FREED_SERIALS 1024
+
 typedef struct Image Image;
 typedef struct ImageInterface ImageInterface;
 
@@ -57,6 +68,12 @@ struct Image {
    * @brief The image type, inferred if instantiated with a Resource.
    */
   const char *type;
+
+  /**
+   * @brief A serial number unique to this Image, so that caches may refer to it without
+   * retaining it.
+   */
+  int serial;
 };
 
 /**
@@ -69,6 +86,28 @@ struct ImageInterface {
    */
   ObjectInterface objectInterface;
 
+  /**
+   * @static
+   * @fn void Image::clearCache(void)
+   * @brief Evicts all Images that are no longer referenced outside of the Image cache.
+   * @memberof Image
+   */
+  void (*clearCache)(void);
+
+  /**
+   * @static
+   * @fn size_t Image::freedSerials(Uint64 *cursor, int *serials, size_t count)
+   * @brief Reads the serial numbers of Images deallocated since `cursor`.
+   * @param cursor The number of deallocations already read, advanced past those returned.
+   * @param serials The serial numbers to populate.
+   * @param count The capacity of `serials`.
+   * @return The number of serial numbers written to `serials`.
+   * @remarks Only the most recent `IMAGE_FREED_SERIALS` deallocations are retained, so that
+   * caches keyed by serial number may release their entries for deallocated Images.
+   * @memberof Image
+   */
+  size_t (*freedSerials)(Uint64 *cursor, int *serials, size_t count);
+
   /**
    * @static
    * @fn Image *Image::imageWithBytes(const uint8_t *bytes, size_t length)
@@ -157,6 +196,8 @@ struct ImageInterface {
    * @param self The Image.
    * @param name The Resource name.
    * @return The initialized Image, or `NULL` on error.
+   * @remarks Images loaded by Resource name are cached, and shared by all callers requesting the
+   * same name. The returned Image may therefore be a retained instance other than `self`.
    * @memberof Image
    */
   Image *(*initWithResourceName)(Image *self, const char *name);
@@ -175,6 +216,18 @@ struct ImageInterface {
    */
   Image *(*initWithSurface)(Image *self, SDL_Surface *surface);
 
+  /**
+   * @fn Image *Image::scaledImage(const Image *self, const SDL_Size *size)
+   * @brief Creates a box-filtered copy of this Image, reduced to the given size.
+   * @param self The Image.
+   * @param size The size, which must not exceed this Image's size in either dimension.
+   * @return The scaled Image, or `NULL` on error.
+   * @remarks Each pixel of the copy is the alpha-weighted average of the pixels it covers, so
+   * that thumbnails of large Images remain smooth and free of dark fringes.
+   * @memberof Image
+   */
+  Image *(*scaledImage)(const Image *self, const SDL_Size *size);
+
   /**
    * @fn SDL_Size Image::size(const Image *self)
    * @param self The Image.
@@ -0,0 +1,335 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#include <Objectively/Array.h>
+
+#include "ImageRequest.h"
+#include "Log.h"
+
+#define _Class _ImageRequest
+
+/**
+ * @brief The pending ImageRequests, in the order they were enqueued.
+ */
+static Array *_queue;
+
+/**
+ * @brief The lock guarding the queue and worker threads.
+ */
+static SDL_Mutex *_lock;
+
+/**
+ * @brief The condition signaled when ImageRequests are enqueued, or the workers should quit.
+ */
+static SDL_Condition *_condition;
+
+/**
+ * @brief The worker threads, which are started on demand.
+ */
+static SDL_Thread *_threads[IMAGE_REQUEST_MAX_THREADS];
+static int _numThreads;
+
+/**
+ * @brief Set when the Class is destroyed, so that the worker threads exit.
+ */
+static bool _quit;
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  ImageRequest *this = (ImageRequest *) self;
+
+  release(this->image);
+  release(this->source);
+
+  free(this->name);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - ImageRequest
+
+/**
+ * @fn void ImageRequest::cancel(ImageRequest *self)
+ * @memberof ImageRequest
+ */
+static void cancel(ImageRequest *self) {
+
+  if (SDL_CompareAndSwapAtomicInt(&self->state, ImageRequestStatePending, ImageRequestStateCancelled)) {
+
+    SDL_LockMutex(_lock);
+
+    $(_queue, removeObject, self);
+
+    SDL_UnlockMutex(_lock);
+  }
+}
+
+/**
+ * @fn ImageRequest *ImageRequest::imageRequestWithImage(Image *image, const SDL_Size *size)
+ * @memberof ImageRequest
+ */
+static ImageRequest *imageRequestWithImage(Image *image, const SDL_Size *size) {
+  return $(alloc(ImageRequest), initWithImage, image, size);
+}
+
+/**
+ * @fn ImageRequest *ImageRequest::imageRequestWithResourceName(const char *name)
+ * @memberof ImageRequest
+ */
+static ImageRequest *imageRequestWithResourceName(const char *name) {
+  return $(alloc(ImageRequest), initWithResourceName, name);
+}
+
+/**
+ * @brief Loads or downscales the Image of the given ImageRequest, and marks it finished.
+ */
+static void execute(ImageRequest *request) {
+
+  if (request->source) {
+    request->image = $(request->source, scaledImage, &request->size);
+  } else {
+    request->image = $$(Image, imageWithResourceName, request->name);
+    if (request->image == NULL) {
+      MVC_LogWarn("Failed to load %s\n", request->name);
+    }
+  }
+
+  SDL_SetAtomicInt(&request->state, ImageRequestStateFinished);
+}
+
+/**
+ * @brief The worker thread function, which executes ImageRequests until the Class is destroyed.
+ */
+static int SDLCALL runRequests(void *data) {
+
+  while (true) {
+
+    SDL_LockMutex(_lock);
+
+    while (_queue->count == 0 && !_quit) {
+      SDL_WaitCondition(_condition, _lock);
+    }
+
+    if (_quit) {
+      SDL_UnlockMutex(_lock);
+      break;
+    }
+
+    ImageRequest *request = retain($(_queue, firstObject));
+    $(_queue, removeObjectAtIndex, 0);
+
+    SDL_UnlockMutex(_lock);
+
+    if (SDL_CompareAndSwapAtomicInt(&request->state, ImageRequestStatePending, ImageRequestStateExecuting)) {
+      execute(request);
+    }
+
+    release(request);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Starts the worker threads, if they are not already running.
+ * @remarks The lock must be held.
+ */
+static void startThreads(void) {
+
+  if (_numThreads) {
+    return;
+  }
+
+  const int count = SDL_clamp(SDL_GetNumLogicalCPUCores() - 1, 1, IMAGE_REQUEST_MAX_THREADS);
+
+  for (int i = 0; i < count; i++) {
+
+    SDL_Thread *thread = SDL_CreateThread(runRequests, "ImageRequest", NULL);
+    if (thread == NULL) {
+      MVC_LogError("Failed to create thread: %s\n", SDL_GetError());
+      break;
+    }
+
+    _threads[_numThreads++] = thread;
+  }
+}
+
+/**
+ * @brief Enqueues the given ImageRequest, or executes it immediately if no worker is available.
+ */
+static void enqueue(ImageRequest *self) {
+
+  SDL_SetAtomicInt(&self->state, ImageRequestStatePending);
+
+  SDL_LockMutex(_lock);
+
+  startThreads();
+
+  const bool enqueued = _numThreads > 0;
+  if (enqueued) {
+    $(_queue, addObject, self);
+    SDL_SignalCondition(_condition);
+  }
+
+  SDL_UnlockMutex(_lock);
+
+  if (!enqueued) {
+    SDL_SetAtomicInt(&self->state, ImageRequestStateExecuting);
+    execute(self);
+  }
+}
+
+/**
+ * @fn ImageRequest *ImageRequest::initWithImage(ImageRequest *self, Image *image, const SDL_Size *size)
+ * @memberof ImageRequest
+ */
+static ImageRequest *initWithImage(ImageRequest *self, Image *image, const SDL_Size *size) {
+
+  assert(image);
+  assert(size);
+
+  self = (ImageRequest *) super(Object, self, init);
+  if (self) {
+
+    self->source = retain(image);
+    self->size = *size;
+
+    enqueue(self);
+  }
+
+  return self;
+}
+
+/**
+ * @fn ImageRequest *ImageRequest::initWithResourceName(ImageRequest *self, const char *name)
+ * @memberof ImageRequest
+ */
+static ImageRequest *initWithResourceName(ImageRequest *self, const char *name) {
+
+  assert(name);
+
+  self = (ImageRequest *) super(Object, self, init);
+  if (self) {
+
+    self->name = strdup(name);
+    assert(self->name);
+
+    enqueue(self);
+  }
+
+  return self;
+}
+
+/**
+ * @fn bool ImageRequest::isFinished(const ImageRequest *self)
+ * @memberof ImageRequest
+ */
+static bool isFinished(const ImageRequest *self) {
+  return SDL_GetAtomicInt((SDL_AtomicInt *) &self->state) == ImageRequestStateFinished;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+  ((ImageRequestInterface *) clazz->interface)->cancel = cancel;
+  ((ImageRequestInterface *) clazz->interface)->imageRequestWithImage = imageRequestWithImage;
+  ((ImageRequestInterface *) clazz->interface)->imageRequestWithResourceName = imageRequestWithResourceName;
+  ((ImageRequestInterface *) clazz->interface)->initWithImage = initWithImage;
+  ((ImageRequestInterface *) clazz->interface)->initWithResourceName = initWithResourceName;
+  ((ImageRequestInterface *) clazz->interface)->isFinished = isFinished;
+
+  _queue = $$(Array, array);
+  assert(_queue);
+
+  _lock = SDL_CreateMutex();
+  assert(_lock);
+
+  _condition = SDL_CreateCondition();
+  assert(_condition);
+}
+
+/**
+ * @see Class::destroy(Class *)
+ */
+static void destroy(Class *clazz) {
+
+  SDL_LockMutex(_lock);
+
+  _quit = true;
+  SDL_BroadcastCondition(_condition);
+
+  SDL_UnlockMutex(_lock);
+
+  for (int i = 0; i < _numThreads; i++) {
+    SDL_WaitThread(_threads[i], NULL);
+  }
+
+  release(_queue);
+
+  SDL_DestroyCondition(_condition);
+  SDL_DestroyMutex(_lock);
+}
+
+/**
+ * @fn Class *ImageRequest::_ImageRequest(void)
+ * @memberof ImageRequest
+ */
+Class *_ImageRequest(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "ImageRequest",
+      .superclass = _Object(),
+      .instanceSize = sizeof(ImageRequest),
+      .interfaceOffset = offsetof(ImageRequest, interface),
+      .interfaceSize = sizeof(ImageRequestInterface),
+      .initialize = initialize,
+      .destroy = destroy,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
@@ -0,0 +1,181 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <SDL3/SDL_atomic.h>
+
+#include <ObjectivelyMVC/Image.h>
+#include <ObjectivelyMVC/Types.h>
+
+/**
+ * @file
+ * @brief Asynchronous Image loading.
+ */
+
+/**
+ * @brief The maximum number of worker threads decoding ImageRequests.
+ */
+#define IMAGE_REQUEST_MAX_THREADS 4
+
+/**
+ * @brief ImageRequest states.
+ */
+typedef enum {
+  ImageRequestStatePending,
+  ImageRequestStateExecuting,
+  ImageRequestStateFinished,
+  ImageRequestStateCancelled
+} ImageRequestState;
+
+typedef struct ImageRequest ImageRequest;
+typedef struct ImageRequestInterface ImageRequestInterface;
+
+/**
+ * @brief ImageRequests load and decode Images by Resource name, or downscale Images, on a pool of
+ * worker threads.
+ * @details Requests are polled, rather than called back, so that the requesting thread decides
+ * when to consume the decoded Image. This allows the render thread to create Textures for
+ * decoded Images without synchronization.
+ * @extends Object
+ */
+struct ImageRequest {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  ImageRequestInterface *interface;
+
+  /**
+   * @brief The decoded or downscaled Image, or `NULL` on error.
+   * @remarks This is only valid once the ImageRequest has finished.
+   */
+  Image *image;
+
+  /**
+   * @brief The Resource name, or `NULL` if this ImageRequest downscales `source`.
+   */
+  char *name;
+
+  /**
+   * @brief The Image to downscale, or `NULL` if this ImageRequest loads `name`.
+   */
+  Image *source;
+
+  /**
+   * @brief The size to which `source` is downscaled.
+   */
+  SDL_Size size;
+
+  /**
+   * @brief The ImageRequestState.
+   * @private
+   */
+  SDL_AtomicInt state;
+};
+
+/**
+ * @brief The ImageRequest interface.
+ */
+struct ImageRequestInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn void ImageRequest::cancel(ImageRequest *self)
+   * @brief Cancels this ImageRequest, if it has not yet begun executing.
+   * @param self The ImageRequest.
+   * @remarks An ImageRequest that is already executing runs to completion, but its Image is
+   * never delivered.
+   * @memberof ImageRequest
+   */
+  void (*cancel)(ImageRequest *self);
+
+  /**
+   * @static
+   * @fn ImageRequest *ImageRequest::imageRequestWithImage(Image *image, const SDL_Size *size)
+   * @brief Instantiates and enqueues a new ImageRequest downscaling the given Image.
+   * @param image The Image.
+   * @param size The size, which must not exceed the Image's size in either dimension.
+   * @return The new ImageRequest.
+   * @memberof ImageRequest
+   */
+  ImageRequest *(*imageRequestWithImage)(Image *image, const SDL_Size *size);
+
+  /**
+   * @static
+   * @fn ImageRequest *ImageRequest::imageRequestWithResourceName(const char *name)
+   * @brief Instantiates and enqueues a new ImageRequest for the Image by the given name.
+   * @param name The Image Resource name.
+   * @return The new ImageRequest.
+   * @memberof ImageRequest
+   */
+  ImageRequest *(*imageRequestWithResourceName)(const char *name);
+
+  /**
+   * @fn ImageRequest *ImageRequest::initWithImage(ImageRequest *self, Image *image, const SDL_Size *size)
+   * @brief Initializes this ImageRequest and enqueues it for downscaling.
+   * @param self The ImageRequest.
+   * @param image The Image.
+   * @param size The size, which must not exceed the Image's size in either dimension.
+   * @return The initialized ImageRequest, or `NULL` on error.
+   * @see Image::scaledImage(const Image *, const SDL_Size *)
+   * @memberof ImageRequest
+   */
+  ImageRequest *(*initWithImage)(ImageRequest *self, Image *image, const SDL_Size *size);
+
+  /**
+   * @fn ImageRequest *ImageRequest::initWithResourceName(ImageRequest *self, const char *name)
+   * @brief Initializes this ImageRequest and enqueues it for decoding.
+   * @param self The ImageRequest.
+   * @param name The Image Resource name.
+   * @return The initialized ImageRequest, or `NULL` on error.
+   * @memberof ImageRequest
+   */
+  ImageRequest *(*initWithResourceName)(ImageRequest *self, const char *name);
+
+  /**
+   * @fn bool ImageRequest::isFinished(const ImageRequest *self)
+   * @param self The ImageRequest.
+   * @return True if this ImageRequest has finished, successfully or otherwise.
+   * @memberof ImageRequest
+   */
+  bool (*isFinished)(const ImageRequest *self);
+};
+
+/**
+ * @fn Class *ImageRequest::_ImageRequest(void)
+ * @brief The ImageRequest archetype.
+ * @return The ImageRequest Class.
+ * @memberof ImageRequest
+ */
+OBJECTIVELYMVC_EXPORT Class *_ImageRequest(void);
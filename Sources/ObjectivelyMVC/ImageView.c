@@ -22,6 +22,7 @@
  */
 
 #include <assert.h>
+#include <math.h>
 
 #include "ImageView.h"
 
@@ -52,6 +53,16 @@ static void dealloc(Object *self) {
 
   ImageView *this = (ImageView *) self;
 
+  if (this->request) {
+    $(this->request, cancel);
+    release(this->request);
+  }
+
+  if (this->downscaleRequest) {
+    $(this->downscaleRequest, cancel);
+    release(this->downscaleRequest);
+  }
+
   release(this->image);
 
   this->texture = release(this->texture);
@@ -74,12 +85,49 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
     MakeInlet("blend.src", InletTypeEnum, &this->blend.src, (ident) SDLGPUBlendFactorNames),
     MakeInlet("blend.dst", InletTypeEnum, &this->blend.dst, (ident) SDLGPUBlendFactorNames),
     MakeInlet("color", InletTypeColor, &this->color, NULL),
-    MakeInlet("image", InletTypeImage, &this->image, NULL)
+    MakeInlet("downscale", InletTypeBool, &this->downscale, NULL),
+    MakeInlet("image", InletTypeImage, &this->image, NULL),
+    MakeInlet("mipmaps", InletTypeBool, &this->mipmaps, NULL)
   );
 
   $(self, bind, inlets, dictionary);
 }
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  ImageView *this = (ImageView *) self;
+  const ImageView *that = (ImageView *) prototype;
+
+  this->blend.src = that->blend.src;
+  this->blend.dst = that->blend.dst;
+  this->color = that->color;
+  this->downscale = that->downscale;
+  this->mipmaps = that->mipmaps;
+
+  release(this->image);
+  this->image = that->image ? retain(that->image) : NULL;
+
+  release(this->texture);
+  this->texture = that->texture ? retain(that->texture) : NULL;
+  this->textureSize = that->textureSize;
+}
+
+/**
+ * @see View::evictTextures(View *)
+ */
+static void evictTextures(View *self) {
+
+  ImageView *this = (ImageView *) self;
+
+  this->texture = release(this->texture);
+  this->textureSize = MakeSize(0, 0);
+}
+
 /**
  * @see View::init(View *)
  */
@@ -87,6 +135,61 @@ static View *init(View *self) {
   return (View *) $((ImageView *) self, initWithImage, NULL);
 }
 
+/**
+ * @return The size in pixels at which to upload the Image of the given ImageView.
+ * @remarks Images are never scaled up, and are uploaded in full until the view has been laid out.
+ */
+static SDL_Size textureSize(const ImageView *self) {
+
+  const SDL_Size imageSize = $(self->image, size);
+
+  if (self->downscale == false || imageSize.w * imageSize.h < IMAGE_VIEW_DOWNSCALE_MIN_PIXELS) {
+    return imageSize;
+  }
+
+  const SDL_Rect frame = $((View *) self, renderFrame);
+  if (frame.w == 0 || frame.h == 0) {
+    return imageSize;
+  }
+
+  const View *view = (View *) self;
+  const float density = view->window ? SDL_GetWindowPixelDensity(view->window) : 1.f;
+
+  return MakeSize(
+    SDL_clamp((int) ceilf(frame.w * density), 1, imageSize.w),
+    SDL_clamp((int) ceilf(frame.h * density), 1, imageSize.h)
+  );
+}
+
+/**
+ * @return The Image of the given ImageView downscaled to `size`, or `NULL` if it is not yet ready.
+ * @remarks The copy is made by an ImageRequest, which is enqueued on first call and polled on
+ * subsequent calls. Should downscaling fail, the full size Image is returned instead.
+ */
+static Image *downscaledImage(ImageView *self, const SDL_Size *size) {
+
+  ImageRequest *request = self->downscaleRequest;
+
+  if (request && (request->source != self->image || request->size.w != size->w || request->size.h != size->h)) {
+    $(request, cancel);
+    request = self->downscaleRequest = release(request);
+  }
+
+  if (request == NULL) {
+    self->downscaleRequest = $$(ImageRequest, imageRequestWithImage, self->image, size);
+    return NULL;
+  }
+
+  if ($(request, isFinished) == false) {
+    return NULL;
+  }
+
+  Image *image = retain(request->image ? request->image : self->image);
+
+  self->downscaleRequest = release(request);
+  return image;
+}
+
 /**
  * @see ViewInterface::render(View *, Renderer *)
  */
@@ -96,11 +199,49 @@ static void render(View *self, Renderer *renderer) {
 
   ImageView *this = (ImageView *) self;
 
-  if (this->texture == NULL) {
-    if (this->image) {
-      this->texture = $(renderer->device, createTextureFromSurface,
-        this->image->surface, SDL_GPU_TEXTUREUSAGE_SAMPLER, false);
-      assert(this->texture);
+  if (this->request && $(this->request, isFinished)) {
+
+    ImageRequest *request = this->request;
+    this->request = NULL;
+
+    if (request->image) {
+      $(this, setImage, request->image);
+    }
+
+    release(request);
+  }
+
+  if (this->image) {
+
+    const SDL_Size size = textureSize(this);
+
+    const bool stale = this->texture && (size.w > this->textureSize.w || size.h > this->textureSize.h ||
+        (size.w * 2 <= this->textureSize.w && size.h * 2 <= this->textureSize.h));
+
+    if (this->texture == NULL || stale) {
+      const SDL_Size imageSize = $(this->image, size);
+
+      if (size.w == imageSize.w && size.h == imageSize.h) {
+        release(this->texture);
+
+        if (this->mipmaps) {
+          this->texture = $(renderer, createTextureForImage, this->image, true);
+        } else {
+          this->texture = $(renderer, textureForImage, this->image);
+        }
+
+        this->textureSize = size;
+      } else {
+        Image *scaled = downscaledImage(this, &size);
+        if (scaled) {
+          release(this->texture);
+
+          this->texture = $(renderer, createTextureForImage, scaled, this->mipmaps);
+          this->textureSize = size;
+
+          release(scaled);
+        }
+      }
     }
   }
 
@@ -125,6 +266,32 @@ static void renderDeviceWillReset(View *self) {
   super(View, self, renderDeviceWillReset);
 }
 
+/**
+ * @see View::texture(const View *)
+ */
+static Texture *texture(const View *self) {
+  return ((ImageView *) self)->texture;
+}
+
+/**
+ * @see View::textureMemory(const View *)
+ */
+static size_t textureMemory(const View *self) {
+
+  const ImageView *this = (ImageView *) self;
+
+  if (this->texture == NULL) {
+    return 0;
+  }
+
+  size_t memory = (size_t) this->textureSize.w * this->textureSize.h * 4;
+  if (this->mipmaps) {
+    memory += memory / 3;
+  }
+
+  return memory;
+}
+
 #pragma mark - ImageView
 
 /**
@@ -139,6 +306,8 @@ static ImageView *initWithFrame(ImageView *self, const SDL_Rect *frame) {
     self->blend.dst = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
 
     self->color = Colors.White;
+
+    self->downscale = true;
   }
 
   return self;
@@ -164,6 +333,16 @@ static ImageView *initWithImage(ImageView *self, Image *image) {
  */
 static void setImage(ImageView *self, Image *image) {
 
+  if (self->request) {
+    $(self->request, cancel);
+    self->request = release(self->request);
+  }
+
+  if (self->downscaleRequest) {
+    $(self->downscaleRequest, cancel);
+    self->downscaleRequest = release(self->downscaleRequest);
+  }
+
   release(self->image);
 
   if (image) {
@@ -180,6 +359,7 @@ static void setImage(ImageView *self, Image *image) {
   }
 
   self->texture = release(self->texture);
+  self->textureSize = MakeSize(0, 0);
 }
 
 /**
@@ -201,11 +381,23 @@ static void setImageWithResource(ImageView *self, const Resource *resource) {
  */
 static void setImageWithResourceName(ImageView *self, const char *name) {
 
-  Resource *resource = $$(Resource, resourceWithName, name);
+  Image *image = $$(Image, imageWithResourceName, name);
+
+  $(self, setImage, image);
+
+  release(image);
+}
+
+/**
+ * @fn void ImageView::setImageWithResourceNameAsync(ImageView *self, const char *name, Image *placeholder)
+ * @memberof ImageView
+ */
+static void setImageWithResourceNameAsync(ImageView *self, const char *name, Image *placeholder) {
 
-  $(self, setImageWithResource, resource);
+  $(self, setImage, placeholder);
 
-  release(resource);
+  self->request = $$(ImageRequest, imageRequestWithResourceName, name);
+  assert(self->request);
 }
 
 /**
@@ -236,15 +428,20 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
   ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->evictTextures = evictTextures;
   ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->render = render;
   ((ViewInterface *) clazz->interface)->renderDeviceWillReset = renderDeviceWillReset;
+  ((ViewInterface *) clazz->interface)->texture = texture;
+  ((ViewInterface *) clazz->interface)->textureMemory = textureMemory;
 
   ((ImageViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
   ((ImageViewInterface *) clazz->interface)->initWithImage = initWithImage;
   ((ImageViewInterface *) clazz->interface)->setImage = setImage;
   ((ImageViewInterface *) clazz->interface)->setImageWithResource = setImageWithResource;
   ((ImageViewInterface *) clazz->interface)->setImageWithResourceName = setImageWithResourceName;
+  ((ImageViewInterface *) clazz->interface)->setImageWithResourceNameAsync = setImageWithResourceNameAsync;
   ((ImageViewInterface *) clazz->interface)->setImageWithSurface = setImageWithSurface;
 }
 
@@ -26,6 +26,7 @@
 #include <SDL3/SDL_gpu.h>
 
 #include <ObjectivelyMVC/Image.h>
+#include <ObjectivelyMVC/ImageRequest.h>
 #include <ObjectivelyMVC/View.h>
 
 /**
@@ -33,6 +34,12 @@
  * @brief ImageViews render an Image in the context of a View hierarchy.
  */
 
+/**
+ * @brief Images with fewer pixels than this are never downscaled, so that their Textures may be
+ * shared by every ImageView displaying them.
+ */
+#define IMAGE_VIEW_DOWNSCALE_MIN_PIXELS (256 * 256)
+
 OBJECTIVELYMVC_EXPORT const EnumName SDLGPUBlendFactorNames[];
 
 typedef struct ImageView ImageView;
@@ -67,15 +74,47 @@ struct ImageView {
    */
   SDL_Color color;
 
+  /**
+   * @brief If true, Images larger than this ImageView's size in pixels are uploaded as
+   * box-filtered copies matching that size. The default is true.
+   * @remarks The copies are made on the ImageRequest worker threads. Until a copy is ready, the
+   * previous Texture, if any, is drawn.
+   */
+  bool downscale;
+
+  /**
+   * @brief The pending ImageRequest downscaling `image`, if any.
+   * @private
+   */
+  ImageRequest *downscaleRequest;
+
   /**
    * @brief The image.
    */
   Image *image;
 
+  /**
+   * @brief If true, mipmaps are generated for the Texture, so that this ImageView remains
+   * smooth while its size is animated. The default is false.
+   */
+  bool mipmaps;
+
+  /**
+   * @brief The pending ImageRequest, if loading asynchronously.
+   * @private
+   */
+  ImageRequest *request;
+
   /**
    * @brief The GPU texture.
    */
   Texture *texture;
+
+  /**
+   * @brief The size of the Texture, which may be smaller than the Image.
+   * @private
+   */
+  SDL_Size textureSize;
 };
 
 /**
@@ -135,6 +174,20 @@ struct ImageViewInterface {
    */
   void (*setImageWithResourceName)(ImageView *self, const char *name);
 
+  /**
+   * @fn void ImageView::setImageWithResourceNameAsync(ImageView *self, const char *name, Image *placeholder)
+   * @brief Sets the Image for this ImageView with the Resource by the given name, decoding it on a
+   * worker thread.
+   * @param self The ImageView.
+   * @param name An Image Resource name.
+   * @param placeholder An optional Image to display while decoding. If `NULL`, this ImageView's
+   * background color is displayed instead.
+   * @remarks The decoded Image is displayed, and its Texture created, on the first render after
+   * decoding completes. Setting another Image, or releasing this ImageView, cancels the request.
+   * @memberof ImageView
+   */
+  void (*setImageWithResourceNameAsync)(ImageView *self, const char *name, Image *placeholder);
+
   /**
    * @fn void ImageView::setImageWithSurface(ImageView *self, SDL_Surface *surface)
    * @brief A convenience method to set this view's Image with a surface.
@@ -0,0 +1,167 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+
+#include "InvalidationSet.h"
+#include "View.h"
+
+#define _Class _InvalidationSet
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  InvalidationSet *this = (InvalidationSet *) self;
+
+  release(this->selectors);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - InvalidationSet
+
+/**
+ * @fn void InvalidationSet::addSelector(InvalidationSet *self, Selector *selector, Invalidation invalidation)
+ * @memberof InvalidationSet
+ */
+static void addSelector(InvalidationSet *self, Selector *selector, Invalidation invalidation) {
+
+  assert(selector);
+
+  self->invalidation |= invalidation;
+
+  if (invalidation & (InvalidationDescendants | InvalidationSiblings)) {
+    if ($(self->selectors, indexOfObject, selector) == -1) {
+      $(self->selectors, addObject, selector);
+    }
+  }
+}
+
+/**
+ * @fn InvalidationSet *InvalidationSet::init(InvalidationSet *self)
+ * @memberof InvalidationSet
+ */
+static InvalidationSet *init(InvalidationSet *self) {
+
+  self = (InvalidationSet *) super(Object, self, init);
+  if (self) {
+    self->selectors = $$(Array, arrayWithCapacity, 4);
+    assert(self->selectors);
+  }
+
+  return self;
+}
+
+/**
+ * @brief ViewEnumerator for invalidateView.
+ * @remarks Only Views matching the rightmost SelectorSequence of a dependent Selector are
+ * invalidated, as no other Views could match a different set of Selectors.
+ */
+static void invalidateView_enumerate(View *view, ident data) {
+
+  const InvalidationSet *self = data;
+
+  if (view->needsApplyTheme) {
+    return;
+  }
+
+  const Array *selectors = (Array *) self->selectors;
+  for (size_t i = 0; i < selectors->count; i++) {
+
+    const Selector *selector = selectors->elements[i];
+    const SelectorSequence *sequence = $((Array *) selector->sequences, lastObject);
+
+    if ($(sequence, matchesView, view)) {
+      view->needsApplyTheme = true;
+      break;
+    }
+  }
+}
+
+/**
+ * @fn void InvalidationSet::invalidateView(const InvalidationSet *self, View *view)
+ * @memberof InvalidationSet
+ */
+static void invalidateView(const InvalidationSet *self, View *view) {
+
+  assert(view);
+
+  if (self->invalidation & InvalidationSelf) {
+    view->needsApplyTheme = true;
+  }
+
+  if (self->invalidation & InvalidationDescendants) {
+    $(view, enumerateDescendants, invalidateView_enumerate, (ident) self);
+  }
+
+  if (self->invalidation & InvalidationSiblings) {
+    if (view->superview) {
+      const Array *siblings = (Array *) view->superview->subviews;
+      for (size_t i = view->subviewIndex + 1; i < siblings->count; i++) {
+        $((View *) siblings->elements[i], enumerate, invalidateView_enumerate, (ident) self);
+      }
+    }
+  }
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+  ((InvalidationSetInterface *) clazz->interface)->addSelector = addSelector;
+  ((InvalidationSetInterface *) clazz->interface)->init = init;
+  ((InvalidationSetInterface *) clazz->interface)->invalidateView = invalidateView;
+}
+
+/**
+ * @fn Class *InvalidationSet::_InvalidationSet(void)
+ * @memberof InvalidationSet
+ */
+Class *_InvalidationSet(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "InvalidationSet",
+      .superclass = _Object(),
+      .instanceSize = sizeof(InvalidationSet),
+      .interfaceOffset = offsetof(InvalidationSet, interface),
+      .interfaceSize = sizeof(InvalidationSetInterface),
+      .initialize = initialize,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
@@ -0,0 +1,128 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+#include <ObjectivelyMVC/Selector.h>
+
+/**
+ * @file
+ * @brief The InvalidationSet type.
+ */
+
+/**
+ * @brief The Views which may be affected by a change to a class name, identifier or pseudo-class.
+ */
+typedef enum {
+  InvalidationNone = 0x0,
+  InvalidationSelf = 0x1,
+  InvalidationDescendants = 0x2,
+  InvalidationSiblings = 0x4
+} Invalidation;
+
+typedef struct InvalidationSet InvalidationSet;
+typedef struct InvalidationSetInterface InvalidationSetInterface;
+
+/**
+ * @brief InvalidationSets describe how a Theme's Selectors depend on a single class name,
+ * identifier or pseudo-class.
+ * @details When a View gains or loses a class name, or changes state, only the View itself, its
+ * descendants or its subsequent siblings may match a different set of Selectors, depending on
+ * where the SimpleSelector appears within those Selectors. Descendants and siblings are further
+ * filtered by the rightmost SelectorSequence of each dependent Selector.
+ * @extends Object
+ * @ingroup Theme
+ */
+struct InvalidationSet {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  InvalidationSetInterface *interface;
+
+  /**
+   * @brief The Invalidation bitmask.
+   */
+  int invalidation;
+
+  /**
+   * @brief The Selectors in which the SimpleSelector appears left of a combinator.
+   */
+  Array *selectors;
+};
+
+/**
+ * @brief The InvalidationSet interface.
+ */
+struct InvalidationSetInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn void InvalidationSet::addSelector(InvalidationSet *self, Selector *selector, Invalidation invalidation)
+   * @brief Adds a dependency on the given Selector to this InvalidationSet.
+   * @param self The InvalidationSet.
+   * @param selector The Selector.
+   * @param invalidation The Invalidation implied by the position of the SimpleSelector.
+   * @memberof InvalidationSet
+   */
+  void (*addSelector)(InvalidationSet *self, Selector *selector, Invalidation invalidation);
+
+  /**
+   * @fn InvalidationSet *InvalidationSet::init(InvalidationSet *self)
+   * @brief Initializes this InvalidationSet.
+   * @param self The InvalidationSet.
+   * @return The initialized InvalidationSet, or `NULL` on error.
+   * @memberof InvalidationSet
+   */
+  InvalidationSet *(*init)(InvalidationSet *self);
+
+  /**
+   * @fn void InvalidationSet::invalidateView(const InvalidationSet *self, View *view)
+   * @brief Invalidates the computed Style of the given View, and of any related Views that may
+   * be affected by this InvalidationSet.
+   * @param self The InvalidationSet.
+   * @param view The View whose class name, identifier or pseudo-class changed.
+   * @memberof InvalidationSet
+   */
+  void (*invalidateView)(const InvalidationSet *self, View *view);
+};
+
+/**
+ * @fn Class *InvalidationSet::_InvalidationSet(void)
+ * @brief The InvalidationSet archetype.
+ * @return The InvalidationSet Class.
+ * @memberof InvalidationSet
+ */
+OBJECTIVELYMVC_EXPORT Class *_InvalidationSet(void);
@@ -49,7 +49,7 @@ static String *description(const Object *self) {
   View *this = (View *) self;
   const SDL_Rect bounds = $(this, bounds);
 
-  String *classNames = $((Object *) this->classNames, description);
+  String *classNames = MVC_AtomsDescription(this->classNames, this->numClassNames);
   String *description = str("%s@%p \"%s\" %s [%d, %d, %d, %d]",
                 this->identifier ?: classnameof(self),
                 self,
@@ -49,7 +49,7 @@ static String *description(const Object *self) {
   View *this = (View *) self;
   const SDL_Rect bounds = $(this, bounds);
 
-  String *classNames = $((Object *) this->classNames, description);
+  String *classNames = MVC_AtomsDescription(this->classNames, this->numClassNames);
   String *description = str("%s@%p \"%s\" %s [%d, %d, %d, %d]",
                 this->identifier ?: classnameof(self),
                 self,
@@ -63,6 +63,33 @@ static String *description(const Object *self) {
 
 #pragma mark - View
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  Option *this = (Option *) self;
+  const Option *that = (Option *) prototype;
+
+  Text *title = (Text *) $(self, counterpart, prototype, (View *) that->title);
+  if (title && title != this->title) {
+    release(this->title);
+    this->title = retain(title);
+  }
+
+  this->isSelected = that->isSelected;
+  this->value = that->value;
+}
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+  return (View *) $((Option *) self, initWithTitle, NULL, NULL);
+}
+
 /**
  * @see View::matchesSelector(const View *, const SimpleSelector *)
  */
@@ -74,7 +101,7 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
 
   switch (simpleSelector->type) {
     case SimpleSelectorTypePseudo:
-      if (strcmp("selected", simpleSelector->pattern) == 0) {
+      if (simpleSelector->pseudoClass == PseudoClassSelected) {
         return this->isSelected;
       }
       break;
@@ -116,7 +143,7 @@ static void setSelected(Option *self, bool isSelected) {
   if (self->isSelected != isSelected) {
     self->isSelected = isSelected;
 
-    $((View *) self, invalidateStyle);
+    $((View *) self, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, "selected");
 
     self->view.needsLayout = true;
   }
@@ -132,6 +159,8 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
   ((ObjectInterface *) clazz->interface)->description = description;
 
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->matchesSelector = matchesSelector;
 
   ((OptionInterface *) clazz->interface)->initWithTitle = initWithTitle;
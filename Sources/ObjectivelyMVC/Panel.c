@@ -66,12 +66,23 @@ static void applyStyle(View *self, const Style *style) {
 
   Panel *this = (Panel *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("draggable", InletTypeBool, &this->isDraggable, NULL),
-    MakeInlet("resizable", InletTypeBool, &this->isResizable, NULL)
-  );
+  for (size_t i = 0; i < style->numValues; i++) {
+
+    StyleValue *value = style->values[i];
+
+    switch (value->property) {
+      case StylePropertyDraggable:
+        $(value, bind, InletTypeBool, &this->isDraggable, NULL);
+        break;
+      case StylePropertyResizable:
+        $(value, bind, InletTypeBool, &this->isResizable, NULL);
+        break;
+      default:
+        continue;
+    }
 
-  $(self, bind, inlets, (Dictionary *) style->attributes);
+    self->needsLayout = true;
+  }
 }
 
 /**
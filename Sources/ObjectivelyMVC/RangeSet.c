@@ -0,0 +1,369 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RangeSet.h"
+
+#define _Class _RangeSet
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  RangeSet *this = (RangeSet *) self;
+
+  free(this->ranges);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - RangeSet
+
+/**
+ * @return One past the last index of `range`.
+ */
+static size_t rangeEnd(const Range range) {
+  return range.location + range.length;
+}
+
+/**
+ * @return The index of the first Range which ends after `index`.
+ */
+static size_t rangeEndingAfter(const RangeSet *self, size_t index) {
+
+  size_t low = 0, high = self->numRanges;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (rangeEnd(self->ranges[mid]) <= index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+/**
+ * @return The index of the first Range which begins after `index`.
+ */
+static size_t rangeBeginningAfter(const RangeSet *self, size_t index) {
+
+  size_t low = 0, high = self->numRanges;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if ((size_t) self->ranges[mid].location <= index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+/**
+ * @brief Replaces the Ranges at `[from, to)` with the given Ranges.
+ */
+static void replaceRanges(RangeSet *self, size_t from, size_t to, const Range *ranges, size_t count) {
+
+  const size_t numRanges = self->numRanges - (to - from) + count;
+  if (numRanges > self->numRanges) {
+    self->ranges = realloc(self->ranges, numRanges * sizeof(Range));
+    assert(self->ranges);
+  }
+
+  memmove(self->ranges + from + count, self->ranges + to, (self->numRanges - to) * sizeof(Range));
+
+  if (count) {
+    memcpy(self->ranges + from, ranges, count * sizeof(Range));
+  }
+
+  self->numRanges = numRanges;
+}
+
+/**
+ * @fn void RangeSet::addIndex(RangeSet *self, size_t index)
+ * @memberof RangeSet
+ */
+static void addIndex(RangeSet *self, size_t index) {
+  $(self, addIndexesInRange, (Range) { .location = index, .length = 1 });
+}
+
+/**
+ * @fn void RangeSet::addIndexesInRange(RangeSet *self, const Range range)
+ * @memberof RangeSet
+ */
+static void addIndexesInRange(RangeSet *self, const Range range) {
+
+  assert(range.location >= 0);
+
+  if (range.length == 0) {
+    return;
+  }
+
+  const size_t a = range.location;
+  const size_t b = rangeEnd(range);
+
+  const size_t i = a ? rangeEndingAfter(self, a - 1) : 0;
+  const size_t j = rangeBeginningAfter(self, b);
+
+  Range merged = range;
+  size_t count = 0;
+
+  if (i < j) {
+    const size_t location = min(a, (size_t) self->ranges[i].location);
+    const size_t end = max(b, rangeEnd(self->ranges[j - 1]));
+
+    for (size_t k = i; k < j; k++) {
+      count += self->ranges[k].length;
+    }
+
+    merged = (Range) { .location = location, .length = end - location };
+  }
+
+  replaceRanges(self, i, j, &merged, 1);
+
+  self->count += merged.length - count;
+}
+
+/**
+ * @fn bool RangeSet::containsIndex(const RangeSet *self, size_t index)
+ * @memberof RangeSet
+ */
+static bool containsIndex(const RangeSet *self, size_t index) {
+
+  const size_t i = rangeEndingAfter(self, index);
+
+  return i < self->numRanges && (size_t) self->ranges[i].location <= index;
+}
+
+/**
+ * @fn void RangeSet::deleteIndexesInRange(RangeSet *self, const Range range)
+ * @memberof RangeSet
+ */
+static void deleteIndexesInRange(RangeSet *self, const Range range) {
+
+  assert(range.location >= 0);
+
+  if (range.length == 0) {
+    return;
+  }
+
+  $(self, removeIndexesInRange, range);
+
+  const size_t i = range.location ? rangeBeginningAfter(self, range.location - 1) : 0;
+
+  for (size_t k = i; k < self->numRanges; k++) {
+    self->ranges[k].location -= range.length;
+  }
+
+  if (i > 0 && i < self->numRanges) {
+    if (rangeEnd(self->ranges[i - 1]) == (size_t) self->ranges[i].location) {
+      self->ranges[i - 1].length += self->ranges[i].length;
+      replaceRanges(self, i, i + 1, NULL, 0);
+    }
+  }
+}
+
+/**
+ * @fn IndexSet *RangeSet::indexSet(const RangeSet *self)
+ * @memberof RangeSet
+ */
+static IndexSet *indexSet(const RangeSet *self) {
+
+  size_t *indexes = NULL;
+
+  if (self->count) {
+    indexes = malloc(self->count * sizeof(size_t));
+    assert(indexes);
+
+    size_t count = 0;
+    for (size_t i = 0; i < self->numRanges; i++) {
+      for (size_t j = 0; j < self->ranges[i].length; j++) {
+        indexes[count++] = self->ranges[i].location + j;
+      }
+    }
+  }
+
+  IndexSet *indexSet = $(alloc(IndexSet), initWithIndexes, indexes, self->count);
+
+  free(indexes);
+  return indexSet;
+}
+
+/**
+ * @fn RangeSet *RangeSet::init(RangeSet *self)
+ * @memberof RangeSet
+ */
+static RangeSet *init(RangeSet *self) {
+  return (RangeSet *) super(Object, self, init);
+}
+
+/**
+ * @fn void RangeSet::insertIndexesInRange(RangeSet *self, const Range range)
+ * @memberof RangeSet
+ */
+static void insertIndexesInRange(RangeSet *self, const Range range) {
+
+  assert(range.location >= 0);
+
+  if (range.length == 0) {
+    return;
+  }
+
+  const size_t a = range.location;
+
+  size_t i = rangeEndingAfter(self, a);
+  if (i < self->numRanges && (size_t) self->ranges[i].location < a) {
+
+    const Range split[] = {
+      { .location = self->ranges[i].location, .length = a - self->ranges[i].location },
+      { .location = a, .length = rangeEnd(self->ranges[i]) - a }
+    };
+
+    replaceRanges(self, i, i + 1, split, lengthof(split));
+    i++;
+  }
+
+  for (size_t k = i; k < self->numRanges; k++) {
+    self->ranges[k].location += range.length;
+  }
+}
+
+/**
+ * @fn void RangeSet::removeAllIndexes(RangeSet *self)
+ * @memberof RangeSet
+ */
+static void removeAllIndexes(RangeSet *self) {
+
+  free(self->ranges);
+  self->ranges = NULL;
+
+  self->numRanges = 0;
+  self->count = 0;
+}
+
+/**
+ * @fn void RangeSet::removeIndex(RangeSet *self, size_t index)
+ * @memberof RangeSet
+ */
+static void removeIndex(RangeSet *self, size_t index) {
+  $(self, removeIndexesInRange, (Range) { .location = index, .length = 1 });
+}
+
+/**
+ * @fn void RangeSet::removeIndexesInRange(RangeSet *self, const Range range)
+ * @memberof RangeSet
+ */
+static void removeIndexesInRange(RangeSet *self, const Range range) {
+
+  assert(range.location >= 0);
+
+  if (range.length == 0) {
+    return;
+  }
+
+  const size_t a = range.location;
+  const size_t b = rangeEnd(range);
+
+  const size_t i = rangeEndingAfter(self, a);
+  const size_t j = rangeBeginningAfter(self, b - 1);
+
+  if (i >= j) {
+    return;
+  }
+
+  Range remainder[2];
+  size_t count = 0;
+
+  size_t removed = 0;
+  for (size_t k = i; k < j; k++) {
+    removed += self->ranges[k].length;
+  }
+
+  if ((size_t) self->ranges[i].location < a) {
+    remainder[count] = (Range) { .location = self->ranges[i].location, .length = a - self->ranges[i].location };
+    removed -= remainder[count++].length;
+  }
+
+  if (rangeEnd(self->ranges[j - 1]) > b) {
+    remainder[count] = (Range) { .location = b, .length = rangeEnd(self->ranges[j - 1]) - b };
+    removed -= remainder[count++].length;
+  }
+
+  replaceRanges(self, i, j, remainder, count);
+
+  self->count -= removed;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+  ((RangeSetInterface *) clazz->interface)->addIndex = addIndex;
+  ((RangeSetInterface *) clazz->interface)->addIndexesInRange = addIndexesInRange;
+  ((RangeSetInterface *) clazz->interface)->containsIndex = containsIndex;
+  ((RangeSetInterface *) clazz->interface)->deleteIndexesInRange = deleteIndexesInRange;
+  ((RangeSetInterface *) clazz->interface)->indexSet = indexSet;
+  ((RangeSetInterface *) clazz->interface)->init = init;
+  ((RangeSetInterface *) clazz->interface)->insertIndexesInRange = insertIndexesInRange;
+  ((RangeSetInterface *) clazz->interface)->removeAllIndexes = removeAllIndexes;
+  ((RangeSetInterface *) clazz->interface)->removeIndex = removeIndex;
+  ((RangeSetInterface *) clazz->interface)->removeIndexesInRange = removeIndexesInRange;
+}
+
+/**
+ * @fn Class *RangeSet::_RangeSet(void)
+ * @memberof RangeSet
+ */
+Class *_RangeSet(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "RangeSet",
+      .superclass = _Object(),
+      .instanceSize = sizeof(RangeSet),
+      .interfaceOffset = offsetof(RangeSet, interface),
+      .interfaceSize = sizeof(RangeSetInterface),
+      .initialize = initialize,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
@@ -0,0 +1,184 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IndexSet.h>
+
+#include <ObjectivelyMVC/Types.h>
+
+/**
+ * @file
+ * @brief The RangeSet type.
+ */
+
+typedef struct RangeSet RangeSet;
+typedef struct RangeSetInterface RangeSetInterface;
+
+/**
+ * @brief RangeSets are mutable sets of indexes, stored as sorted, disjoint Ranges.
+ * @details RangeSets are well suited to selections, which tend to be contiguous: selecting or
+ * deselecting any number of contiguous indexes costs a single Range, and membership is resolved
+ * by binary search over the Ranges.
+ * @extends Object
+ * @ingroup Tables
+ */
+struct RangeSet {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  RangeSetInterface *interface;
+
+  /**
+   * @brief The number of indexes.
+   */
+  size_t count;
+
+  /**
+   * @brief The number of Ranges.
+   */
+  size_t numRanges;
+
+  /**
+   * @brief The Ranges, in ascending order. Adjacent Ranges are always coalesced.
+   */
+  Range *ranges;
+};
+
+/**
+ * @brief The RangeSet interface.
+ */
+struct RangeSetInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn void RangeSet::addIndex(RangeSet *self, size_t index)
+   * @brief Adds the given index to this RangeSet.
+   * @param self The RangeSet.
+   * @param index The index.
+   * @memberof RangeSet
+   */
+  void (*addIndex)(RangeSet *self, size_t index);
+
+  /**
+   * @fn void RangeSet::addIndexesInRange(RangeSet *self, const Range range)
+   * @brief Adds the indexes in the given Range to this RangeSet.
+   * @param self The RangeSet.
+   * @param range The Range.
+   * @memberof RangeSet
+   */
+  void (*addIndexesInRange)(RangeSet *self, const Range range);
+
+  /**
+   * @fn bool RangeSet::containsIndex(const RangeSet *self, size_t index)
+   * @param self The RangeSet.
+   * @param index The index.
+   * @return True if this RangeSet contains `index`, false otherwise.
+   * @memberof RangeSet
+   */
+  bool (*containsIndex)(const RangeSet *self, size_t index);
+
+  /**
+   * @fn void RangeSet::deleteIndexesInRange(RangeSet *self, const Range range)
+   * @brief Removes the indexes in the given Range, and shifts all subsequent indexes down by the
+   * length of the Range.
+   * @param self The RangeSet.
+   * @param range The Range.
+   * @remarks This is useful for maintaining a RangeSet as elements are deleted from a collection.
+   * @memberof RangeSet
+   */
+  void (*deleteIndexesInRange)(RangeSet *self, const Range range);
+
+  /**
+   * @fn IndexSet *RangeSet::indexSet(const RangeSet *self)
+   * @param self The RangeSet.
+   * @return A new IndexSet containing the indexes of this RangeSet.
+   * @memberof RangeSet
+   */
+  IndexSet *(*indexSet)(const RangeSet *self);
+
+  /**
+   * @fn RangeSet *RangeSet::init(RangeSet *self)
+   * @brief Initializes this RangeSet.
+   * @param self The RangeSet.
+   * @return The initialized RangeSet, or `NULL` on error.
+   * @memberof RangeSet
+   */
+  RangeSet *(*init)(RangeSet *self);
+
+  /**
+   * @fn void RangeSet::insertIndexesInRange(RangeSet *self, const Range range)
+   * @brief Shifts all indexes at or after the location of the given Range up by its length.
+   * @param self The RangeSet.
+   * @param range The Range.
+   * @remarks The indexes in `range` are not added to this RangeSet. This is useful for
+   * maintaining a RangeSet as elements are inserted into a collection.
+   * @memberof RangeSet
+   */
+  void (*insertIndexesInRange)(RangeSet *self, const Range range);
+
+  /**
+   * @fn void RangeSet::removeAllIndexes(RangeSet *self)
+   * @brief Removes all indexes from this RangeSet.
+   * @param self The RangeSet.
+   * @memberof RangeSet
+   */
+  void (*removeAllIndexes)(RangeSet *self);
+
+  /**
+   * @fn void RangeSet::removeIndex(RangeSet *self, size_t index)
+   * @brief Removes the given index from this RangeSet.
+   * @param self The RangeSet.
+   * @param index The index.
+   * @memberof RangeSet
+   */
+  void (*removeIndex)(RangeSet *self, size_t index);
+
+  /**
+   * @fn void RangeSet::removeIndexesInRange(RangeSet *self, const Range range)
+   * @brief Removes the indexes in the given Range from this RangeSet.
+   * @param self The RangeSet.
+   * @param range The Range.
+   * @memberof RangeSet
+   */
+  void (*removeIndexesInRange)(RangeSet *self, const Range range);
+};
+
+/**
+ * @fn Class *RangeSet::_RangeSet(void)
+ * @brief The RangeSet archetype.
+ * @return The RangeSet Class.
+ * @memberof RangeSet
+ */
+OBJECTIVELYMVC_EXPORT Class *_RangeSet(void);
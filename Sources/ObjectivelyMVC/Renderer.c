@@ -22,14 +22,17 @@
  */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <Objectively/Number.h>
 #include <Objectively/Vector.h>
 #include <ObjectivelyGPU/CopyPass.h>
 #include <ObjectivelyGPU/Mathlib.h>
 #include <ObjectivelyGPU/RenderPass.h>
 
+#include "Log.h"
 #include "Renderer.h"
 #include "View.h"
 #include "Window.h"
@@ -78,6 +81,8 @@ static void dealloc(Object *self) {
 
   this->commands = NULL;
 
+  release(this->textures);
+  release(this->textureSizes);
   release(this->vertices);
   release(this->drawArrays);
   release(this->device);
@@ -107,12 +112,103 @@ static void beginFrameWith(Renderer *self, CommandBuffer *commands, Framebuffer
   self->commands = commands;
   self->framebuffer = framebuffer;
 
+  self->frameCount++;
+
   $(self->vertices, removeAll);
   $(self->drawArrays, removeAll);
 
   self->scissor = MakeRect(0, 0, framebuffer->size.w, framebuffer->size.h);
 }
 
+/**
+ * @fn Texture *Renderer::createTextureForImage(Renderer *self, const Image *image, bool mipmaps)
+ * @memberof Renderer
+ */
+static Texture *createTextureForImage(Renderer *self, const Image *image, bool mipmaps) {
+
+  assert(image);
+
+  if (image->surface == NULL) {
+    return NULL;
+  }
+
+  SDL_GPUTextureUsageFlags usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+  if (mipmaps) {
+    usage |= SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+  }
+
+  Texture *texture = $(self->device, createTextureFromSurface, image->surface, usage, mipmaps);
+  if (texture == NULL) {
+    MVC_LogError("Failed to create Texture: %s\n", SDL_GetError());
+  }
+
+  return texture;
+}
+
+/**
+ * @return The size in bytes of the Texture for `image`.
+ */
+static size_t sizeOfTexture(const Image *image) {
+  return (size_t) image->surface->w * image->surface->h * 4;
+}
+
+/**
+ * @brief Evicts Textures referenced only by this Renderer, until they fit within `budget`.
+ */
+static void evictTextures(Renderer *self, size_t budget) {
+
+  if (self->texturesSize <= budget) {
+    return;
+  }
+
+  Array *serials = $(self->textures, allKeys);
+  assert(serials);
+
+  for (size_t i = 0; i < serials->count && self->texturesSize > budget; i++) {
+
+    const Number *serial = serials->elements[i];
+    const Texture *texture = $(self->textures, objectForKey, (ident) serial);
+
+    if (((Object *) texture)->referenceCount == 1) {
+      const Number *size = $(self->textureSizes, objectForKey, (ident) serial);
+      self->texturesSize -= (size_t) size->value;
+
+      $(self->textures, removeObjectForKey, (ident) serial);
+      $(self->textureSizes, removeObjectForKey, (ident) serial);
+    }
+  }
+
+  release(serials);
+}
+
+/**
+ * @brief Evicts the unreferenced Textures of Images that have been deallocated.
+ */
+static void evictFreedTextures(Renderer *self) {
+
+  int serials[64];
+  size_t count;
+
+  while ((count = $$(Image, freedSerials, &self->freedImages, serials, lengthof(serials)))) {
+    for (size_t i = 0; i < count; i++) {
+
+      Number *serial = $$(Number, numberWithValue, serials[i]);
+      assert(serial);
+
+      const Texture *texture = $(self->textures, objectForKey, serial);
+      if (texture && ((Object *) texture)->referenceCount == 1) {
+        const Number *size = $(self->textureSizes, objectForKey, serial);
+        self->texturesSize -= (size_t) size->value;
+
+        $(self->textures, removeObjectForKey, serial);
+        $(self->textureSizes, removeObjectForKey, serial);
+      }
+
+      release(serial);
+    }
+  }
+}
+
 /**
  * @fn void Renderer::drawLine(const Renderer *self, const SDL_Point *points, const SDL_Color *color)
  * @memberof Renderer
@@ -245,6 +341,8 @@ static void drawView(Renderer *self, View *view) {
   if (clippingFrame.w && clippingFrame.h) {
     $(self, setClippingFrame, &clippingFrame);
     $(view, render, self);
+
+    view->lastDrawn = self->frameCount;
   }
 }
 
@@ -328,11 +426,201 @@ static Renderer *initWithDevice(Renderer *self, RenderDevice *device) {
 
     self->drawArrays = $(alloc(Vector), initWithSize, sizeof(MVC_DrawArrays));
     assert(self->drawArrays);
+
+    self->textures = $$(Dictionary, dictionary);
+    assert(self->textures);
+
+    self->textureSizes = $$(Dictionary, dictionary);
+    assert(self->textureSizes);
+
+    self->textureBudget = RENDERER_TEXTURE_BUDGET;
   }
 
   return self;
 }
 
+/**
+ * @brief A View holding a Texture, gathered by `manageTextures`.
+ */
+typedef struct {
+  View *view;
+  const Texture *texture;
+  size_t memory;
+} TextureHolder;
+
+/**
+ * @brief The Views holding a common Texture, so that shared Textures are counted once.
+ */
+typedef struct {
+  const TextureHolder *holders;
+  size_t count;
+  size_t memory;
+  Uint64 lastDrawn;
+  bool cached;
+} TextureGroup;
+
+/**
+ * @brief ViewEnumerator for manageTextures.
+ */
+static void manageTextures_enumerate(View *view, ident data) {
+
+  const Texture *texture = $(view, texture);
+  if (texture) {
+    $((Vector *) data, add, &(TextureHolder) {
+      .view = view,
+      .texture = texture,
+      .memory = $(view, textureMemory),
+    });
+  }
+}
+
+/**
+ * @brief qsort comparator for Texture addresses.
+ */
+static int compareTextures(const void *a, const void *b) {
+
+  const uintptr_t textureA = (uintptr_t) *(const Texture **) a;
+  const uintptr_t textureB = (uintptr_t) *(const Texture **) b;
+
+  return (textureA > textureB) - (textureA < textureB);
+}
+
+/**
+ * @brief qsort comparator for TextureHolder sorting by Texture address.
+ */
+static int compareTextureHolders(const void *a, const void *b) {
+  return compareTextures(&((const TextureHolder *) a)->texture, &((const TextureHolder *) b)->texture);
+}
+
+/**
+ * @brief qsort comparator for least recently drawn TextureGroup sorting.
+ */
+static int compareTextureGroups(const void *a, const void *b) {
+
+  const Uint64 lastDrawnA = ((const TextureGroup *) a)->lastDrawn;
+  const Uint64 lastDrawnB = ((const TextureGroup *) b)->lastDrawn;
+
+  return (lastDrawnA > lastDrawnB) - (lastDrawnA < lastDrawnB);
+}
+
+/**
+ * @return The Textures in the Image Texture cache of `self`, sorted by address.
+ */
+static const Texture **cachedTextures(const Renderer *self, size_t *count) {
+
+  Array *serials = $(self->textures, allKeys);
+  assert(serials);
+
+  const Texture **textures = calloc(serials->count + 1, sizeof(Texture *));
+  assert(textures);
+
+  for (size_t i = 0; i < serials->count; i++) {
+    textures[i] = $(self->textures, objectForKey, serials->elements[i]);
+  }
+
+  qsort(textures, serials->count, sizeof(Texture *), compareTextures);
+
+  *count = serials->count;
+
+  release(serials);
+  return textures;
+}
+
+/**
+ * @fn void Renderer::manageTextures(Renderer *self, View *view)
+ * @memberof Renderer
+ */
+static void manageTextures(Renderer *self, View *view) {
+
+  assert(view);
+
+  if (self->frameCount - self->texturesManaged < RENDERER_TEXTURE_INTERVAL) {
+    return;
+  }
+
+  self->texturesManaged = self->frameCount;
+
+  evictFreedTextures(self);
+
+  Vector *holders = $(alloc(Vector), initWithSize, sizeof(TextureHolder));
+  assert(holders);
+
+  $(view, enumerate, manageTextures_enumerate, holders);
+
+  qsort(holders->elements, holders->count, sizeof(TextureHolder), compareTextureHolders);
+
+  size_t numCached;
+  const Texture **cached = cachedTextures(self, &numCached);
+
+  TextureGroup *groups = calloc(holders->count + 1, sizeof(TextureGroup));
+  assert(groups);
+
+  size_t numGroups = 0, memory = 0;
+
+  for (size_t i = 0; i < holders->count; i++) {
+
+    const TextureHolder *holder = VectorElement(holders, TextureHolder, i);
+
+    TextureGroup *group = numGroups ? &groups[numGroups - 1] : NULL;
+    if (group == NULL || group->holders->texture != holder->texture) {
+      group = &groups[numGroups++];
+
+      group->holders = holder;
+      group->memory = holder->memory;
+      group->cached = bsearch(&holder->texture, cached, numCached, sizeof(Texture *), compareTextures) != NULL;
+
+      if (group->cached == false) {
+        memory += group->memory;
+      }
+    }
+
+    group->count++;
+    group->lastDrawn = SDL_max(group->lastDrawn, holder->view->lastDrawn);
+  }
+
+  free(cached);
+
+  if (memory + self->texturesSize > self->textureBudget) {
+
+    evictTextures(self, memory < self->textureBudget ? self->textureBudget - memory : 0);
+
+    qsort(groups, numGroups, sizeof(TextureGroup), compareTextureGroups);
+
+    size_t reclaimed = 0;
+
+    for (size_t i = 0; i < numGroups; i++) {
+
+      if (memory + self->texturesSize - reclaimed <= self->textureBudget) {
+        break;
+      }
+
+      const TextureGroup *group = &groups[i];
+      if (group->lastDrawn >= self->frameCount) {
+        break;
+      }
+
+      for (size_t j = 0; j < group->count; j++) {
+        $(group->holders[j].view, evictTextures);
+      }
+
+      if (group->cached) {
+        reclaimed += group->memory;
+      } else {
+        memory -= group->memory;
+      }
+    }
+
+    if (reclaimed) {
+      evictTextures(self, memory < self->textureBudget ? self->textureBudget - memory : 0);
+    }
+  }
+
+  self->textureMemory = memory + self->texturesSize;
+
+  free(groups);
+  release(holders);
+}
+
 /**
  * @fn void Renderer::pushDrawArrays(const Renderer *self, const MVC_Vertex *verts, size_t count, Texture *texture, const SDL_Color *color)
  * @memberof Renderer
@@ -479,6 +767,10 @@ static void renderDeviceWillReset(Renderer *self) {
 
   $(self->vertices, removeAll);
   $(self->drawArrays, removeAll);
+
+  $(self->textures, removeAllObjects);
+  $(self->textureSizes, removeAllObjects);
+  self->texturesSize = 0;
 }
 
 /**
@@ -494,6 +786,50 @@ static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
   }
 }
 
+/**
+ * @fn Texture *Renderer::textureForImage(Renderer *self, const Image *image)
+ * @memberof Renderer
+ */
+static Texture *textureForImage(Renderer *self, const Image *image) {
+
+  assert(image);
+
+  if (image->surface == NULL) {
+    return NULL;
+  }
+
+  Number *serial = $$(Number, numberWithValue, image->serial);
+  assert(serial);
+
+  Texture *texture = $(self->textures, objectForKey, serial);
+  if (texture) {
+    release(serial);
+    return retain(texture);
+  }
+
+  texture = $(self, createTextureForImage, image, false);
+  if (texture == NULL) {
+    release(serial);
+    return NULL;
+  }
+
+  const size_t size = sizeOfTexture(image);
+
+  Number *number = $$(Number, numberWithValue, size);
+  assert(number);
+
+  $(self->textures, setObjectForKey, texture, serial);
+  $(self->textureSizes, setObjectForKey, number, serial);
+  self->texturesSize += size;
+
+  release(number);
+  release(serial);
+
+  evictTextures(self, RENDERER_TEXTURE_CACHE_BUDGET);
+
+  return texture;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -505,6 +841,7 @@ static void initialize(Class *clazz) {
 
   ((RendererInterface *) clazz->interface)->beginFrame = beginFrame;
   ((RendererInterface *) clazz->interface)->beginFrameWith = beginFrameWith;
+  ((RendererInterface *) clazz->interface)->createTextureForImage = createTextureForImage;
   ((RendererInterface *) clazz->interface)->drawLine = drawLine;
   ((RendererInterface *) clazz->interface)->drawLines = drawLines;
   ((RendererInterface *) clazz->interface)->drawRect = drawRect;
@@ -513,10 +850,12 @@ static void initialize(Class *clazz) {
   ((RendererInterface *) clazz->interface)->drawView = drawView;
   ((RendererInterface *) clazz->interface)->endFrame = endFrame;
   ((RendererInterface *) clazz->interface)->initWithDevice = initWithDevice;
+  ((RendererInterface *) clazz->interface)->manageTextures = manageTextures;
   ((RendererInterface *) clazz->interface)->pushDrawArrays = pushDrawArrays;
   ((RendererInterface *) clazz->interface)->renderDeviceDidReset = renderDeviceDidReset;
   ((RendererInterface *) clazz->interface)->renderDeviceWillReset = renderDeviceWillReset;
   ((RendererInterface *) clazz->interface)->setClippingFrame = setClippingFrame;
+  ((RendererInterface *) clazz->interface)->textureForImage = textureForImage;
 
   $$(Resource, addResourceProvider, shaderResourceProvider);
 }
@@ -25,11 +25,13 @@
 
 #include <SDL3/SDL_gpu.h>
 
+#include <Objectively/Dictionary.h>
 #include <Objectively/Object.h>
 #include <Objectively/Vector.h>
 
 #include <ObjectivelyGPU.h>
 
+#include "Image.h"
 #include "Types.h"
 
 /**
@@ -39,6 +41,25 @@
  * streaming, draw call queue, scissor state, and draw* helpers.
  */
 
+/**
+ * @brief The size in bytes of Image Textures that a Renderer retains while unreferenced.
+ * @remarks Textures in use are never evicted, regardless of this budget.
+ */
+#define RENDERER_TEXTURE_CACHE_BUDGET (64 * 1024 * 1024)
+
+/**
+ * @brief The default size in bytes of the Textures that Views may hold before the least recently
+ * drawn are evicted.
+ * @see Renderer::manageTextures(Renderer *, View *)
+ */
+#define RENDERER_TEXTURE_BUDGET (128 * 1024 * 1024)
+
+/**
+ * @brief The number of frames between Texture accounting passes.
+ * @see Renderer::manageTextures(Renderer *, View *)
+ */
+#define RENDERER_TEXTURE_INTERVAL 60
+
 typedef struct Renderer Renderer;
 typedef struct RendererInterface RendererInterface;
 
@@ -97,6 +118,11 @@ struct Renderer {
    */
   Vector *drawArrays;
 
+  /**
+   * @brief The frame number, incremented by `beginFrameWith`.
+   */
+  Uint64 frameCount;
+
   /**
    * @brief The current frame Framebuffer (valid between beginFrame and endFrame).
    * @details Borrowed reference — valid only while the frame is in flight. Do not retain.
@@ -124,6 +150,52 @@ struct Renderer {
    */
   SDL_Rect scissor;
 
+  /**
+   * @brief The size in bytes of the Textures that Views may hold while they are not drawn.
+   * @details Defaults to `RENDERER_TEXTURE_BUDGET`.
+   * @see Renderer::manageTextures(Renderer *, View *)
+   */
+  size_t textureBudget;
+
+  /**
+   * @brief The size in bytes of all UI Textures, as of the last accounting pass of `manageTextures`.
+   * @remarks This includes Textures held by Views and by the Image Texture cache.
+   */
+  size_t textureMemory;
+
+  /**
+   * @brief The frame at which `manageTextures` last accounted for the View hierarchy.
+   * @private
+   */
+  Uint64 texturesManaged;
+
+  /**
+   * @brief The Image Textures created by this Renderer, keyed by Image serial number.
+   * @details Keying by serial number, rather than by Image, allows the Image cache to evict
+   * Images whose Textures remain cached. Released in `renderDeviceWillReset`.
+   * @private
+   */
+  Dictionary *textures;
+
+  /**
+   * @brief The size in bytes of each Texture in `textures`, keyed by Image serial number.
+   * @private
+   */
+  Dictionary *textureSizes;
+
+  /**
+   * @brief The size in bytes of the Textures in `textures`.
+   * @private
+   */
+  size_t texturesSize;
+
+  /**
+   * @brief The number of Image deallocations read by `manageTextures`.
+   * @see Image::freedSerials(Uint64 *, int *, size_t)
+   * @private
+   */
+  Uint64 freedImages;
+
   /**
    * @brief CPU-side frame accumulation of vertices.
    * @private
@@ -181,6 +253,18 @@ struct RendererInterface {
    */
   void (*beginFrameWith)(Renderer *self, CommandBuffer *commands, Framebuffer *framebuffer);
 
+  /**
+   * @fn Texture *Renderer::createTextureForImage(Renderer *self, const Image *image, bool mipmaps)
+   * @brief Creates a new Texture for the given Image, bypassing the Texture cache.
+   * @param self The Renderer.
+   * @param image The Image.
+   * @param mipmaps True to generate mipmaps, for Images drawn at varying scales.
+   * @return The new Texture, or `NULL` on error.
+   * @see Renderer::textureForImage(Renderer *, const Image *)
+   * @memberof Renderer
+   */
+  Texture *(*createTextureForImage)(Renderer *self, const Image *image, bool mipmaps);
+
   /**
    * @fn void Renderer::drawLine(const Renderer *self, const SDL_Point *points, const SDL_Color *color)
    * @brief Records a line segment between two points.
@@ -262,6 +346,25 @@ struct RendererInterface {
    */
   Renderer *(*initWithDevice)(Renderer *self, RenderDevice *device);
 
+  /**
+   * @fn void Renderer::manageTextures(Renderer *self, View *view)
+   * @brief Updates `textureMemory` for the given View hierarchy, and evicts Textures if it
+   * exceeds `textureBudget`.
+   * @details Unreferenced Image Textures are evicted first. Then Views that were not drawn in the
+   * current frame are evicted in least recently drawn order until the hierarchy fits within
+   * budget. A Texture shared by several Views, or with the Image Texture cache, is counted once,
+   * and is evicted from all of the Views holding it. Evicted Views recreate their Textures lazily
+   * on their next render. Call this after drawing the View hierarchy, and before `endFrame`.
+   * @remarks The View hierarchy is only walked once every `RENDERER_TEXTURE_INTERVAL` frames;
+   * calls in between return immediately. Unreferenced Textures of deallocated Images are released
+   * on each such pass.
+   * @param self The Renderer.
+   * @param view The root View.
+   * @see View::evictTextures(View *)
+   * @memberof Renderer
+   */
+  void (*manageTextures)(Renderer *self, View *view);
+
   /**
    * @fn void Renderer::pushDrawArrays(const Renderer *self, const MVC_Vertex *verts, size_t count, Texture *texture, const SDL_Color *color)
    * @brief Appends raw vertices and a draw call record to the frame queue.
@@ -302,6 +405,18 @@ struct RendererInterface {
    * @memberof Renderer
    */
   void (*setClippingFrame)(Renderer *self, const SDL_Rect *clippingFrame);
+
+  /**
+   * @fn Texture *Renderer::textureForImage(Renderer *self, const Image *image)
+   * @brief Resolves the Texture for the given Image, uploading it on first use.
+   * @details Textures are shared by all Views rendering the same Image with this Renderer, so
+   *   that many Views displaying a common Image consume a single Texture.
+   * @param self The Renderer.
+   * @param image The Image.
+   * @return The Texture, retained for the caller, or `NULL` on error.
+   * @memberof Renderer
+   */
+  Texture *(*textureForImage)(Renderer *self, const Image *image);
 };
 
 /**
@@ -70,11 +70,10 @@ static void applyStyle(View *self, const Style *style) {
 
   ScrollView *this = (ScrollView *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("scrollbar", InletTypeEnum, &this->scrollBarVisibility, (ident) ScrollBarVisibilityNames)
-  );
-
-  $(self, bind, inlets, (Dictionary *) style->attributes);
+  StyleValue *scrollbar = $(style, valueForProperty, StylePropertyScrollbar);
+  if (scrollbar) {
+    $(scrollbar, bind, InletTypeEnum, &this->scrollBarVisibility, (ident) ScrollBarVisibilityNames);
+  }
 
   self->needsLayout = true;
 }
@@ -191,27 +190,32 @@ static ScrollView *initWithFrame(ScrollView *self, const SDL_Rect *frame) {
  */
 static void scrollToOffset(ScrollView *self, const SDL_Point *offset) {
 
+  SDL_Point contentOffset = MakePoint(0, 0);
+
   if (self->contentView) {
     const SDL_Size contentSize = $(self->contentView, size);
     const SDL_Rect bounds = $((View *) self, bounds);
 
     if (contentSize.w > bounds.w) {
-      self->contentOffset.x = clamp(offset->x, -(contentSize.w - bounds.w), 0);
-    } else {
-      self->contentOffset.x = 0;
+      contentOffset.x = clamp(offset->x, -(contentSize.w - bounds.w), 0);
     }
 
     if (contentSize.h > bounds.h) {
-      self->contentOffset.y = clamp(offset->y, -(contentSize.h - bounds.h), 0);
-    } else {
-      self->contentOffset.y = 0;
+      contentOffset.y = clamp(offset->y, -(contentSize.h - bounds.h), 0);
     }
+  }
 
-  } else {
-    self->contentOffset.x = self->contentOffset.y = 0;
+  if (contentOffset.x == self->contentOffset.x && contentOffset.y == self->contentOffset.y) {
+    return;
+  }
+
+  self->contentOffset = contentOffset;
+
+  if (self->contentView) {
+    self->contentView->frame.x = contentOffset.x;
+    self->contentView->frame.y = contentOffset.y;
   }
 
-  self->control.view.needsLayout = true;
   ((View *) self->scrollBar)->needsLayout = true;
 }
 
@@ -238,6 +242,8 @@ static void setContentView(ScrollView *self, View *contentView) {
     $((View *) self, addSubview, (View *) self->scrollBar);
 
     $(self, scrollToOffset, &MakePoint(0, 0));
+
+    self->control.view.needsLayout = true;
   }
 }
 
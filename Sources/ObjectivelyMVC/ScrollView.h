@@ -125,6 +125,8 @@ struct ScrollViewInterface {
    * @brief Scrolls the content View to the specified offset.
    * @param self The ScrollView.
    * @param offset The offset.
+   * @remarks Scrolling only translates the content View. Neither this ScrollView nor its content
+   * is laid out again, since the content's frames are relative to the content View.
    * @memberof ScrollView
    */
   void (*scrollToOffset)(ScrollView *self, const SDL_Point *offset);
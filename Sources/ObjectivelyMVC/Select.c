@@ -48,6 +48,22 @@ static void dealloc(Object *self) {
 
 #pragma mark - View
 
+/**
+ * @see View::awakeWithDictionary(View *, const Dictionary *)
+ */
+static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
+
+  super(View, self, awakeWithDictionary, dictionary);
+
+  Select *this = (Select *) self;
+
+  const Inlet inlets[] = MakeInlets(
+    MakeInlet("maxVisibleOptions", InletTypeInteger, &this->maxVisibleOptions, NULL)
+  );
+
+  $(self, bind, inlets, dictionary);
+}
+
 /**
  * @see View::init(View *)
  */
@@ -55,6 +71,75 @@ static View *init(View *self) {
   return (View *) $((Select *) self, initWithFrame, NULL);
 }
 
+/**
+ * @return True if only a window of the Options is added to the StackView, false otherwise.
+ */
+static bool isVirtualized(const Select *self) {
+  return self->maxVisibleOptions > 0 && self->options->count > (size_t) self->maxVisibleOptions;
+}
+
+/**
+ * @brief Adds the Options beginning at `firstVisibleOption` to the StackView, if they are not
+ * already there, replacing any others.
+ */
+static void layoutVisibleOptions(Select *self) {
+
+  const Array *options = (Array *) self->options;
+
+  size_t count = options->count;
+  if (isVirtualized(self)) {
+    count = self->maxVisibleOptions;
+    self->firstVisibleOption = min(self->firstVisibleOption, options->count - count);
+  } else {
+    self->firstVisibleOption = 0;
+  }
+
+  View *stackView = (View *) self->stackView;
+  const Array *subviews = (Array *) stackView->subviews;
+
+  bool isCurrent = subviews->count == count;
+  for (size_t i = 0; i < count && isCurrent; i++) {
+    isCurrent = subviews->elements[i] == options->elements[self->firstVisibleOption + i];
+  }
+
+  if (isCurrent) {
+    return;
+  }
+
+  while (subviews->count) {
+    $(stackView, removeSubview, $(subviews, lastObject));
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    $(stackView, addSubview, options->elements[self->firstVisibleOption + i]);
+  }
+
+  self->control.view.needsLayout = true;
+}
+
+/**
+ * @brief Scrolls the Options, if necessary, so that the given Option is in the StackView.
+ */
+static void scrollToOption(Select *self, const Option *option) {
+
+  if (option && isVirtualized(self)) {
+
+    const ssize_t index = $((Array *) self->options, indexOfObject, (ident) option);
+    if (index > -1) {
+
+      const size_t count = self->maxVisibleOptions;
+
+      if ((size_t) index < self->firstVisibleOption) {
+        self->firstVisibleOption = index;
+      } else if ((size_t) index >= self->firstVisibleOption + count) {
+        self->firstVisibleOption = index - count + 1;
+      }
+    }
+  }
+
+  layoutVisibleOptions(self);
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -66,7 +151,7 @@ static void layoutSubviews(View *self) {
 
   if (control->selection == ControlSelectionSingle) {
 
-    const Array *options = (Array *) this->options;
+    const Array *options = (Array *) ((View *) this->stackView)->subviews;
     for (size_t i = 0; i < options->count; i++) {
 
       Option *option = $(options, objectAtIndex, i);
@@ -116,7 +201,7 @@ static SDL_Size sizeThatFits(const View *self) {
 
   SDL_Size size = super(View, self, sizeThatFits);
 
-  const Array *options = (Array *) this->options;
+  const Array *options = (Array *) ((View *) this->stackView)->subviews;
   for (size_t i = 0; i < options->count; i++) {
 
     const View *option = $(options, objectAtIndex, i);
@@ -151,9 +236,10 @@ static bool captureEvent(Control *self, const SDL_Event *event) {
     if (self->state & ControlStateHighlighted) {
       self->state &= ~ControlStateHighlighted;
 
-      for (size_t i = 0; i < options->count; i++) {
+      const Array *visibleOptions = (Array *) ((View *) this->stackView)->subviews;
+      for (size_t i = 0; i < visibleOptions->count; i++) {
 
-        Option *option = $(options, objectAtIndex, i);
+        Option *option = $(visibleOptions, objectAtIndex, i);
         if ($((View *) option, didReceiveEvent, event)) {
           $(this, selectOption, option);
           if (this->delegate.didSelectOption) {
@@ -168,6 +254,20 @@ static bool captureEvent(Control *self, const SDL_Event *event) {
     }
   }
 
+  if (event->type == SDL_EVENT_MOUSE_WHEEL && isVirtualized(this)) {
+    if (self->selection != ControlSelectionSingle || (self->state & ControlStateHighlighted)) {
+
+      if (event->wheel.integer_y) {
+        const ssize_t first = (ssize_t) this->firstVisibleOption - event->wheel.integer_y;
+        this->firstVisibleOption = max(first, 0);
+
+        layoutVisibleOptions(this);
+      }
+
+      return true;
+    }
+  }
+
   if (event->type == SDL_EVENT_KEY_DOWN) {
 
     switch (event->key.key) {
@@ -217,6 +317,8 @@ static void stateDidChange(Control *self) {
 
   if (self->selection == ControlSelectionSingle) {
 
+    scrollToOption(this, $(this, selectedOption));
+
     View *stackView = (View *) this->stackView;
 
     if ($(self, isHighlighted)) {
@@ -254,17 +356,30 @@ static void stateDidChange(Control *self) {
 #pragma mark - Select
 
 /**
- * @brief ArrayEnumerator to remove Options from the stackView.
+ * @brief Sorts the Options, ensures a selection, and updates the StackView after a batch of
+ * changes.
  */
-static void addOption_removeSubview(const Array *array, ident obj, ident data) {
-  $((View *) data, removeSubview, obj);
-}
+static void reloadOptions(Select *self) {
 
-/**
- * @brief ArrayEnumerator to add Options to the stackView.
- */
-static void addOption_addSubview(const Array *array, ident obj, ident data) {
-  $((View *) data, addSubview, obj);
+  if (self->comparator) {
+    $(self->options, sort, self->comparator);
+  }
+
+  Option *option = NULL;
+
+  if (self->control.selection == ControlSelectionSingle) {
+    option = $(self, selectedOption);
+    if (option == NULL) {
+      option = $((Array *) self->options, firstObject);
+      if (option) {
+        $(option, setSelected, true);
+      }
+    }
+  }
+
+  scrollToOption(self, option);
+
+  self->control.view.needsLayout = true;
 }
 
 /**
@@ -276,27 +391,99 @@ static void addOption(Select *self, const char *title, ident value) {
   Option *option = $(alloc(Option), initWithTitle, title, value);
   assert(option);
 
-  $(self->options, addObject, option);
+  option->view.nextResponder = (View *) self;
 
-  $((Array *) self->options, enumerate, addOption_removeSubview, self->stackView);
+  if (self->updateDepth) {
+    $(self->options, addObject, option);
+  } else {
 
-  if (self->comparator) {
-    $(self->options, sort, self->comparator);
-  }
+    const Array *options = (Array *) self->options;
 
-  $((Array *) self->options, enumerate, addOption_addSubview, self->stackView);
+    size_t index = options->count;
+    if (self->comparator) {
 
-  if (self->control.selection == ControlSelectionSingle) {
-    if ($(self, selectedOption) == NULL) {
-      $(option, setSelected, true);
+      size_t low = 0, high = options->count;
+      while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (self->comparator(options->elements[mid], option) == OrderDescending) {
+          high = mid;
+        } else {
+          low = mid + 1;
+        }
+      }
+
+      index = low;
     }
-  }
 
-  option->view.nextResponder = (View *) self;
+    if (index == options->count) {
+      $(self->options, addObject, option);
+    } else {
+      $(self->options, insertObjectAtIndex, option, index);
+    }
+
+    if (self->control.selection == ControlSelectionSingle) {
+      if ($(self, selectedOption) == NULL) {
+        $(option, setSelected, true);
+      }
+    }
+
+    if (isVirtualized(self)) {
+      layoutVisibleOptions(self);
+    } else {
+      View *next = index + 1 < options->count ? options->elements[index + 1] : NULL;
+      $((View *) self->stackView, addSubviewRelativeTo, (View *) option, next, ViewPositionBefore);
+    }
+
+    self->control.view.needsLayout = true;
+  }
 
   release(option);
+}
 
-  self->control.view.needsLayout = true;
+/**
+ * @brief ArrayEnumerator for addOptions.
+ */
+static void addOptions_enumerate(const Array *array, ident obj, ident data) {
+
+  Select *self = (Select *) data;
+
+  ((Option *) obj)->view.nextResponder = (View *) self;
+
+  $(self->options, addObject, obj);
+}
+
+/**
+ * @fn void Select::addOptions(Select *self, const Array *options)
+ * @memberof Select
+ */
+static void addOptions(Select *self, const Array *options) {
+
+  if (options) {
+    $(self, beginUpdates);
+    $(options, enumerate, addOptions_enumerate, self);
+    $(self, endUpdates);
+  }
+}
+
+/**
+ * @fn void Select::beginUpdates(Select *self)
+ * @memberof Select
+ */
+static void beginUpdates(Select *self) {
+  self->updateDepth++;
+}
+
+/**
+ * @fn void Select::endUpdates(Select *self)
+ * @memberof Select
+ */
+static void endUpdates(Select *self) {
+
+  assert(self->updateDepth > 0);
+
+  if (--self->updateDepth == 0) {
+    reloadOptions(self);
+  }
 }
 
 /**
@@ -310,6 +497,8 @@ static Select *initWithFrame(Select *self, const SDL_Rect *frame) {
 
     self->control.selection = ControlSelectionSingle;
 
+    self->maxVisibleOptions = 32;
+
     self->options = $$(Array, arrayWithCapacity, 8);
     assert(self->options);
 
@@ -337,19 +526,24 @@ static Option *optionWithValue(const Select *self, const ident value) {
   return $((Array *) self->options, find, optionWithValue_predicate, value);
 }
 
-/**
- * @brief ArrayEnumerator for removeAllOptions.
- */
-static void removeAllOptions_enumerate(const Array *array, ident obj, ident data) {
-  $((Select *) data, removeOption, obj);
-}
-
 /**
  * @fn void Select::removeAllOptions(Select *self)
  * @memberof Select
  */
 static void removeAllOptions(Select *self) {
-  $((Array *) self->options, enumerate, removeAllOptions_enumerate, self);
+
+  View *stackView = (View *) self->stackView;
+  const Array *subviews = (Array *) stackView->subviews;
+
+  while (subviews->count) {
+    $(stackView, removeSubview, $(subviews, lastObject));
+  }
+
+  $(self->options, removeAllObjects);
+
+  self->firstVisibleOption = 0;
+
+  self->control.view.needsLayout = true;
 }
 
 /**
@@ -358,18 +552,24 @@ static void removeAllOptions(Select *self) {
  */
 static void removeOption(Select *self, Option *option) {
 
-  if ($((Array *) self->options, containsObject, option)) {
+  const ssize_t index = $((Array *) self->options, indexOfObject, option);
+  if (index > -1) {
 
-    $(self->options, removeObject, option);
     $((View *) self->stackView, removeSubview, (View *) option);
+    $(self->options, removeObjectAtIndex, index);
 
-    if (self->control.selection == ControlSelectionSingle) {
-      if ($(self, selectedOption) == NULL) {
-        Option *first_option = $((Array *) self->options, firstObject);
-        if (first_option) {
-          $(self, selectOption, first_option);
+    if (self->updateDepth == 0) {
+
+      if (self->control.selection == ControlSelectionSingle) {
+        if ($(self, selectedOption) == NULL) {
+          Option *first_option = $((Array *) self->options, firstObject);
+          if (first_option) {
+            $(self, selectOption, first_option);
+          }
         }
       }
+
+      layoutVisibleOptions(self);
     }
 
     self->control.view.needsLayout = true;
@@ -410,6 +610,10 @@ static void selectOption(Select *self, Option *option) {
     if (option && option->isSelected == false) {
       $(option, setSelected, true);
     }
+
+    if (self->updateDepth == 0) {
+      scrollToOption(self, option);
+    }
   }
 
   self->control.view.needsLayout = true;
@@ -449,6 +653,20 @@ static Array *selectedOptions(const Select *self) {
   return $((Array *) self->options, filteredArray, selectedOptions_predicate, NULL);
 }
 
+/**
+ * @fn void Select::setOptions(Select *self, const Array *options)
+ * @memberof Select
+ */
+static void setOptions(Select *self, const Array *options) {
+
+  $(self, beginUpdates);
+
+  $(self, removeAllOptions);
+  $(self, addOptions, options);
+
+  $(self, endUpdates);
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -458,6 +676,7 @@ static void initialize(Class *clazz) {
 
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
+  ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
   ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->layoutSubviews = layoutSubviews;
   ((ViewInterface *) clazz->interface)->sizeThatFits = sizeThatFits;
@@ -466,6 +685,9 @@ static void initialize(Class *clazz) {
   ((ControlInterface *) clazz->interface)->stateDidChange = stateDidChange;
 
   ((SelectInterface *) clazz->interface)->addOption = addOption;
+  ((SelectInterface *) clazz->interface)->addOptions = addOptions;
+  ((SelectInterface *) clazz->interface)->beginUpdates = beginUpdates;
+  ((SelectInterface *) clazz->interface)->endUpdates = endUpdates;
   ((SelectInterface *) clazz->interface)->initWithFrame = initWithFrame;
   ((SelectInterface *) clazz->interface)->optionWithValue = optionWithValue;
   ((SelectInterface *) clazz->interface)->removeAllOptions = removeAllOptions;
@@ -475,6 +697,7 @@ static void initialize(Class *clazz) {
   ((SelectInterface *) clazz->interface)->selectOptionWithValue = selectOptionWithValue;
   ((SelectInterface *) clazz->interface)->selectedOption = selectedOption;
   ((SelectInterface *) clazz->interface)->selectedOptions = selectedOptions;
+  ((SelectInterface *) clazz->interface)->setOptions = setOptions;
 }
 
 /**
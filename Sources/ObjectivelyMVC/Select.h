@@ -83,6 +83,19 @@ struct Select {
    */
   SelectDelegate delegate;
 
+  /**
+   * @brief The index of the first Option in the StackView.
+   * @remarks This is always `0` unless the Options exceed `maxVisibleOptions`.
+   * @private
+   */
+  size_t firstVisibleOption;
+
+  /**
+   * @brief The maximum number of Options displayed at once. When there are more Options than
+   * this, only a scrollable window of them is added to the StackView. `0` for no limit.
+   */
+  int maxVisibleOptions;
+
   /**
    * @brief The Options.
    */
@@ -92,6 +105,12 @@ struct Select {
    * @brief The StackView for rendering the Options.
    */
   StackView *stackView;
+
+  /**
+   * @brief The nesting depth of Select::beginUpdates.
+   * @private
+   */
+  int updateDepth;
 };
 
 /**
@@ -114,6 +133,36 @@ struct SelectInterface {
    */
   void (*addOption)(Select *self, const char *title, ident value);
 
+  /**
+   * @fn void Select::addOptions(Select *self, const Array *options)
+   * @brief Adds the given Options to this Select.
+   * @param self The Select.
+   * @param options The Options to add.
+   * @remarks The Options are sorted and added to the StackView once, rather than once per Option.
+   * @memberof Select
+   */
+  void (*addOptions)(Select *self, const Array *options);
+
+  /**
+   * @fn void Select::beginUpdates(Select *self)
+   * @brief Begins a batch of Option changes.
+   * @param self The Select.
+   * @remarks Until the matching Select::endUpdates, Options are added and removed without
+   * sorting them or updating the StackView. Calls may be nested.
+   * @memberof Select
+   */
+  void (*beginUpdates)(Select *self);
+
+  /**
+   * @fn void Select::endUpdates(Select *self)
+   * @brief Ends a batch of Option changes.
+   * @param self The Select.
+   * @remarks When the outermost batch ends, the Options are sorted and the StackView is updated
+   * once for all of them.
+   * @memberof Select
+   */
+  void (*endUpdates)(Select *self);
+
   /**
    * @fn Select *Select::initWithFrame(Select *self, const SDL_Rect *frame)
    * @brief Initializes this Select with the specified frame and style.
@@ -194,6 +243,15 @@ struct SelectInterface {
    * @memberof Select
    */
   Array *(*selectedOptions)(const Select *self);
+
+  /**
+   * @fn void Select::setOptions(Select *self, const Array *options)
+   * @brief Replaces all Options of this Select with the given Options.
+   * @param self The Select.
+   * @param options The Options.
+   * @memberof Select
+   */
+  void (*setOptions)(Select *self, const Array *options);
 };
 
 /**
@@ -31,6 +31,7 @@
 
 #include "Log.h"
 #include "Selector.h"
+#include "SelectorFilter.h"
 #include "View.h"
 
 #define _Class _Selector
@@ -92,6 +93,51 @@ static bool isEqual(const Object *self, const Object *other) {
 
 #pragma mark - Selector
 
+/**
+ * @brief Populates the ancestor hashes of the given Selector.
+ * @remarks SelectorSequences to the left of a descendant or child combinator must match an
+ * ancestor of the matched View. Their type, class and identifier SimpleSelectors are hashed so
+ * that a SelectorFilter may reject this Selector without walking the View hierarchy.
+ */
+static void ancestorHashes(Selector *selector) {
+
+  selector->numAncestorHashes = 0;
+
+  for (size_t i = selector->sequences->count - 1; i > 0; i--) {
+    const SelectorSequence *sequence = $(selector->sequences, objectAtIndex, i - 1);
+
+    switch (sequence->right) {
+      case SequenceCombinatorDescendent:
+      case SequenceCombinatorChild:
+        break;
+      default:
+        continue;
+    }
+
+    for (size_t j = 0; j < sequence->simpleSelectors->count; j++) {
+      const SimpleSelector *simpleSelector = $(sequence->simpleSelectors, objectAtIndex, j);
+
+      if (selector->numAncestorHashes == SELECTOR_MAX_ANCESTOR_HASHES) {
+        return;
+      }
+
+      switch (simpleSelector->type) {
+        case SimpleSelectorTypeType:
+        case SimpleSelectorTypeId:
+          selector->ancestorHashes[selector->numAncestorHashes++] =
+            SelectorFilterHash(simpleSelector->type, simpleSelector->pattern);
+          break;
+        case SimpleSelectorTypeClass:
+          selector->ancestorHashes[selector->numAncestorHashes++] =
+            SelectorFilterAtomHash(simpleSelector->atom);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
 /**
  * @return The specificity of the given Selector.
  */
@@ -115,7 +161,7 @@ static int specificity(const Selector *selector) {
           break;
         case SimpleSelectorTypeType: {
           specificity += 1;
-          Class *clazz = classForName(simpleSelector->pattern);
+          const Class *clazz = simpleSelector->clazz;
           if (clazz) {
             while (clazz) {
               if (clazz == _View()) {
@@ -189,16 +235,35 @@ static void enumerateSelection(const Selector *self, View *view, ViewEnumerator
  */
 static Selector *initWithRule(Selector *self, const char *rule) {
 
+  assert(rule);
+
+  Array *sequences = $$(SelectorSequence, parse, rule);
+  assert(sequences);
+
+  self = $(self, initWithSequences, rule, sequences);
+
+  release(sequences);
+  return self;
+}
+
+/**
+ * @fn Selector *Selector::initWithSequences(Selector *self, const char *rule, Array *sequences)
+ * @memberof Selector
+ */
+static Selector *initWithSequences(Selector *self, const char *rule, Array *sequences) {
+
   self = (Selector *) super(Object, self, init);
   if (self) {
 
     self->rule = strtrim(rule);
     assert(self->rule);
 
-    self->sequences = $$(SelectorSequence, parse, self->rule);
+    self->sequences = retain(sequences);
     assert(self->sequences->count);
 
     self->specificity = specificity(self);
+
+    ancestorHashes(self);
   }
 
   return self;
@@ -491,6 +556,7 @@ static void initialize(Class *clazz) {
   ((SelectorInterface *) clazz->interface)->enumerateSelection = enumerateSelection;
   ((SelectorInterface *) clazz->interface)->compareTo = compareTo;
   ((SelectorInterface *) clazz->interface)->initWithRule = initWithRule;
+  ((SelectorInterface *) clazz->interface)->initWithSequences = initWithSequences;
   ((SelectorInterface *) clazz->interface)->matchesView = matchesView;
   ((SelectorInterface *) clazz->interface)->parse = parse;
   ((SelectorInterface *) clazz->interface)->select = _select;
@@ -36,6 +36,11 @@
 
 typedef struct Style Style;
 
+/**
+ * @brief The maximum number of ancestor hashes retained by a Selector.
+ */
+#define SELECTOR_MAX_ANCESTOR_HASHES 4
+
 typedef struct Selector Selector;
 typedef struct SelectorInterface SelectorInterface;
 
@@ -59,6 +64,18 @@ struct Selector {
    */
   SelectorInterface *interface;
 
+  /**
+   * @brief The hashes of SimpleSelectors which must match an ancestor of the matched View.
+   * @remarks These are used to reject this Selector via SelectorFilter without walking ancestors.
+   * @see SelectorFilter::rejectsSelector(const SelectorFilter *, const Selector *)
+   */
+  unsigned int ancestorHashes[SELECTOR_MAX_ANCESTOR_HASHES];
+
+  /**
+   * @brief The count of `ancestorHashes`.
+   */
+  size_t numAncestorHashes;
+
   /**
    * @brief The sequences.
    */
@@ -123,6 +140,18 @@ struct SelectorInterface {
    */
   Selector *(*initWithRule)(Selector *self, const char *rule);
 
+  /**
+   * @fn Selector *Selector::initWithSequences(Selector *self, const char *rule, Array *sequences)
+   * @brief Initializes this Selector with the given, previously parsed, SelectorSequences.
+   * @param self The Selector.
+   * @param rule The rule.
+   * @param sequences The SelectorSequences of `rule`.
+   * @return The initialized Selector, or `NULL` on error.
+   * @remarks Designated initializer.
+   * @memberof Selector
+   */
+  Selector *(*initWithSequences)(Selector *self, const char *rule, Array *sequences);
+
   /**
    * @fn bool Selector::matchesView(const Selector *self, View *view)
    * @param self The Selector.
@@ -0,0 +1,251 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/String.h>
+
+#include "SelectorFilter.h"
+#include "View.h"
+
+#define _Class _SelectorFilter
+
+#define SELECTOR_FILTER_KEY_MASK (SELECTOR_FILTER_SIZE - 1)
+
+#define SelectorFilterKey1(hash) ((hash) & SELECTOR_FILTER_KEY_MASK)
+#define SelectorFilterKey2(hash) (((hash) >> 12) & SELECTOR_FILTER_KEY_MASK)
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  SelectorFilter *this = (SelectorFilter *) self;
+
+  free(this->hashes);
+  free(this->frames);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - SelectorFilter
+
+/**
+ * @brief Increments the counters for the given hash.
+ * @remarks Saturated counters are never decremented, which may only yield false positives.
+ */
+static void incrementCounters(SelectorFilter *self, unsigned int hash) {
+
+  uint8_t *a = &self->counters[SelectorFilterKey1(hash)];
+  uint8_t *b = &self->counters[SelectorFilterKey2(hash)];
+
+  if (*a < UINT8_MAX) {
+    (*a)++;
+  }
+  if (*b < UINT8_MAX) {
+    (*b)++;
+  }
+}
+
+/**
+ * @brief Decrements the counters for the given hash.
+ */
+static void decrementCounters(SelectorFilter *self, unsigned int hash) {
+
+  uint8_t *a = &self->counters[SelectorFilterKey1(hash)];
+  uint8_t *b = &self->counters[SelectorFilterKey2(hash)];
+
+  if (*a < UINT8_MAX) {
+    assert(*a);
+    (*a)--;
+  }
+  if (*b < UINT8_MAX) {
+    assert(*b);
+    (*b)--;
+  }
+}
+
+/**
+ * @brief Pushes the given hash onto the current frame.
+ */
+static void pushHash(SelectorFilter *self, unsigned int hash) {
+
+  if (self->numHashes == self->maxHashes) {
+    self->maxHashes = self->maxHashes ? self->maxHashes << 1 : 64;
+    self->hashes = realloc(self->hashes, self->maxHashes * sizeof(unsigned int));
+    assert(self->hashes);
+  }
+
+  self->hashes[self->numHashes++] = hash;
+
+  incrementCounters(self, hash);
+}
+
+/**
+ * @fn void SelectorFilter::addView(SelectorFilter *self, const View *view)
+ * @memberof SelectorFilter
+ */
+static void addView(SelectorFilter *self, const View *view) {
+
+  assert(view);
+
+  if (self->numFrames == self->maxFrames) {
+    self->maxFrames = self->maxFrames ? self->maxFrames << 1 : 16;
+    self->frames = realloc(self->frames, self->maxFrames * sizeof(size_t));
+    assert(self->frames);
+  }
+
+  self->frames[self->numFrames++] = self->numHashes;
+
+  if (view->identifier) {
+    pushHash(self, SelectorFilterHash(SimpleSelectorTypeId, view->identifier));
+  }
+
+  for (size_t i = 0; i < view->numClassNames; i++) {
+    pushHash(self, SelectorFilterAtomHash(view->classNames[i]));
+  }
+
+  for (const Class *clazz = classof(view); clazz; clazz = clazz->def.superclass) {
+    pushHash(self, SelectorFilterHash(SimpleSelectorTypeType, clazz->def.name));
+    if (clazz == _View()) {
+      break;
+    }
+  }
+
+  self->view = view;
+}
+
+/**
+ * @fn SelectorFilter *SelectorFilter::init(SelectorFilter *self)
+ * @memberof SelectorFilter
+ */
+static SelectorFilter *init(SelectorFilter *self) {
+
+  self = (SelectorFilter *) super(Object, self, init);
+  if (self) {
+    memset(self->counters, 0, sizeof(self->counters));
+  }
+
+  return self;
+}
+
+/**
+ * @fn bool SelectorFilter::rejectsSelector(const SelectorFilter *self, const Selector *selector)
+ * @memberof SelectorFilter
+ */
+static bool rejectsSelector(const SelectorFilter *self, const Selector *selector) {
+
+  assert(selector);
+
+  for (size_t i = 0; i < selector->numAncestorHashes; i++) {
+    const unsigned int hash = selector->ancestorHashes[i];
+
+    if (self->counters[SelectorFilterKey1(hash)] == 0 || self->counters[SelectorFilterKey2(hash)] == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @fn void SelectorFilter::removeView(SelectorFilter *self)
+ * @memberof SelectorFilter
+ */
+static void removeView(SelectorFilter *self) {
+
+  assert(self->numFrames);
+
+  const size_t frame = self->frames[--self->numFrames];
+
+  while (self->numHashes > frame) {
+    decrementCounters(self, self->hashes[--self->numHashes]);
+  }
+
+  self->view = self->view ? self->view->superview : NULL;
+
+  if (self->numFrames == 0) {
+    self->view = NULL;
+  }
+}
+
+/**
+ * @fn void SelectorFilter::resetWithView(SelectorFilter *self, const View *view)
+ * @memberof SelectorFilter
+ */
+static void resetWithView(SelectorFilter *self, const View *view) {
+
+  memset(self->counters, 0, sizeof(self->counters));
+
+  self->numHashes = self->numFrames = 0;
+  self->view = NULL;
+
+  if (view) {
+    $(self, resetWithView, view->superview);
+    $(self, addView, view);
+  }
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+  ((SelectorFilterInterface *) clazz->interface)->addView = addView;
+  ((SelectorFilterInterface *) clazz->interface)->init = init;
+  ((SelectorFilterInterface *) clazz->interface)->rejectsSelector = rejectsSelector;
+  ((SelectorFilterInterface *) clazz->interface)->removeView = removeView;
+  ((SelectorFilterInterface *) clazz->interface)->resetWithView = resetWithView;
+}
+
+/**
+ * @fn Class *SelectorFilter::_SelectorFilter(void)
+ * @memberof SelectorFilter
+ */
+Class *_SelectorFilter(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "SelectorFilter",
+      .superclass = _Object(),
+      .instanceSize = sizeof(SelectorFilter),
+      .interfaceOffset = offsetof(SelectorFilter, interface),
+      .interfaceSize = sizeof(SelectorFilterInterface),
+      .initialize = initialize,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
@@ -0,0 +1,179 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Hash.h>
+
+#include <ObjectivelyMVC/Selector.h>
+
+/**
+ * @file
+ * @brief The SelectorFilter type.
+ */
+
+/**
+ * @brief The number of counters in a SelectorFilter (12 bit keys).
+ */
+#define SELECTOR_FILTER_SIZE (1 << 12)
+
+/**
+ * @brief The SelectorFilter hash for the given SimpleSelectorType and pattern.
+ * @remarks Views and Selectors must agree on this function for rejection to be sound.
+ */
+#define SelectorFilterHash(type, pattern) \
+  ((unsigned int) HashForCString((int) (type), (pattern)))
+
+/**
+ * @brief The SelectorFilter hash for the given class name Atom.
+ */
+#define SelectorFilterAtomHash(atom) \
+  ((unsigned int) (atom) * 2654435761u)
+
+typedef struct SelectorFilter SelectorFilter;
+typedef struct SelectorFilterInterface SelectorFilterInterface;
+
+/**
+ * @brief SelectorFilters are counting bloom filters of the identifiers, class names and types of
+ * a View's ancestors.
+ * @details During View::applyThemeIfNeeded, the Theme's SelectorFilter is maintained as the View
+ * hierarchy is walked, so that Selectors with descendant or child combinators can be rejected
+ * without enumerating ancestors. A SelectorFilter may yield false positives, but never false
+ * negatives.
+ * @extends Object
+ * @ingroup Theme
+ */
+struct SelectorFilter {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  SelectorFilterInterface *interface;
+
+  /**
+   * @brief The counters.
+   * @private
+   */
+  uint8_t counters[SELECTOR_FILTER_SIZE];
+
+  /**
+   * @brief The stack of hashes added for each View, so that they may be removed exactly.
+   * @private
+   */
+  unsigned int *hashes;
+
+  /**
+   * @brief The count and capacity of `hashes`.
+   * @private
+   */
+  size_t numHashes, maxHashes;
+
+  /**
+   * @brief The stack of offsets into `hashes` at which each View's hashes begin.
+   * @private
+   */
+  size_t *frames;
+
+  /**
+   * @brief The count and capacity of `frames`.
+   * @private
+   */
+  size_t numFrames, maxFrames;
+
+  /**
+   * @brief The most recently added View.
+   * @remarks This SelectorFilter describes the ancestors of this View's subviews. If `NULL`, this
+   * SelectorFilter is empty, and describes the ancestors of root Views.
+   */
+  const View *view;
+};
+
+/**
+ * @brief The SelectorFilter interface.
+ */
+struct SelectorFilterInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn void SelectorFilter::addView(SelectorFilter *self, const View *view)
+   * @brief Adds the identifier, class names and types of the given View to this SelectorFilter.
+   * @param self The SelectorFilter.
+   * @param view The View, which must be a subview of the most recently added View.
+   * @memberof SelectorFilter
+   */
+  void (*addView)(SelectorFilter *self, const View *view);
+
+  /**
+   * @fn SelectorFilter *SelectorFilter::init(SelectorFilter *self)
+   * @brief Initializes this SelectorFilter.
+   * @param self The SelectorFilter.
+   * @return The initialized SelectorFilter, or `NULL` on error.
+   * @memberof SelectorFilter
+   */
+  SelectorFilter *(*init)(SelectorFilter *self);
+
+  /**
+   * @fn bool SelectorFilter::rejectsSelector(const SelectorFilter *self, const Selector *selector)
+   * @param self The SelectorFilter.
+   * @param selector The Selector.
+   * @return True if `selector` can not match any subview of this SelectorFilter's View, false
+   * if it may.
+   * @memberof SelectorFilter
+   */
+  bool (*rejectsSelector)(const SelectorFilter *self, const Selector *selector);
+
+  /**
+   * @fn void SelectorFilter::removeView(SelectorFilter *self)
+   * @brief Removes the most recently added View from this SelectorFilter.
+   * @param self The SelectorFilter.
+   * @memberof SelectorFilter
+   */
+  void (*removeView)(SelectorFilter *self);
+
+  /**
+   * @fn void SelectorFilter::resetWithView(SelectorFilter *self, const View *view)
+   * @brief Clears this SelectorFilter, and then adds `view` and all of its ancestors.
+   * @param self The SelectorFilter.
+   * @param view The View, or `NULL` to simply clear this SelectorFilter.
+   * @memberof SelectorFilter
+   */
+  void (*resetWithView)(SelectorFilter *self, const View *view);
+};
+
+/**
+ * @fn Class *SelectorFilter::_SelectorFilter(void)
+ * @brief The SelectorFilter archetype.
+ * @return The SelectorFilter Class.
+ * @memberof SelectorFilter
+ */
+OBJECTIVELYMVC_EXPORT Class *_SelectorFilter(void);
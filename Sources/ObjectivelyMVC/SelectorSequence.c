@@ -65,6 +65,23 @@ static String *description(const Object *self) {
  */
 static SelectorSequence *initWithSequence(SelectorSequence *self, const char *sequence) {
 
+  assert(sequence);
+
+  Array *simpleSelectors = $$(SimpleSelector, parse, sequence);
+  assert(simpleSelectors);
+
+  self = $(self, initWithSimpleSelectors, sequence, simpleSelectors);
+
+  release(simpleSelectors);
+  return self;
+}
+
+/**
+ * @fn SelectorSequence *SelectorSequence::initWithSimpleSelectors(SelectorSequence *self, const char *sequence, Array *simpleSelectors)
+ * @memberof SelectorSequence
+ */
+static SelectorSequence *initWithSimpleSelectors(SelectorSequence *self, const char *sequence, Array *simpleSelectors) {
+
   self = (SelectorSequence *) super(Object, self, init);
   if (self) {
 
@@ -73,7 +90,7 @@ static SelectorSequence *initWithSequence(SelectorSequence *self, const char *se
 
     assert(strlen(self->sequence));
 
-    self->simpleSelectors = $$(SimpleSelector, parse, self->sequence);
+    self->simpleSelectors = retain(simpleSelectors);
     assert(self->simpleSelectors->count);
   }
 
@@ -179,6 +196,7 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->description = description;
 
   ((SelectorSequenceInterface *) clazz->interface)->initWithSequence = initWithSequence;
+  ((SelectorSequenceInterface *) clazz->interface)->initWithSimpleSelectors = initWithSimpleSelectors;
   ((SelectorSequenceInterface *) clazz->interface)->matchesView = matchesView;
   ((SelectorSequenceInterface *) clazz->interface)->parse = parse;
 }
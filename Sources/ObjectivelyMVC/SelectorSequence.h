@@ -101,6 +101,18 @@ struct SelectorSequenceInterface {
    */
   SelectorSequence *(*initWithSequence)(SelectorSequence *self, const char *sequence);
 
+  /**
+   * @fn SelectorSequence *SelectorSequence::initWithSimpleSelectors(SelectorSequence *self, const char *sequence, Array *simpleSelectors)
+   * @brief Initializes this SelectorSequence with the given, previously parsed, SimpleSelectors.
+   * @param self The SelectorSequence.
+   * @param sequence A C-string specifying a sequence of SimpleSelectors.
+   * @param simpleSelectors The SimpleSelectors of `sequence`.
+   * @return The initialized SelectorSequence, or `NULL` on error.
+   * @remarks Designated initializer.
+   * @memberof SelectorSequence
+   */
+  SelectorSequence *(*initWithSimpleSelectors)(SelectorSequence *self, const char *sequence, Array *simpleSelectors);
+
   /**
    * @fn bool SelectorSequence::matchesView(const SelectorSequence *self, const View *view)
    * @param self The SelectorSequence.
@@ -107,6 +107,78 @@ static SimpleSelector *initWithPattern(SimpleSelector *self, const char *pattern
   return self;
 }
 
+/**
+ * @brief The recognized pseudo-class patterns.
+ */
+static const struct {
+  const char *pattern;
+  PseudoClass pseudoClass;
+} pseudoClasses[] = {
+  { "disabled", PseudoClassDisabled },
+  { "first-child", PseudoClassFirstChild },
+  { "focused", PseudoClassFocused },
+  { "highlighted", PseudoClassHighlighted },
+  { "hover", PseudoClassHover },
+  { "last-child", PseudoClassLastChild },
+  { "multiple", PseudoClassMultiple },
+  { "nth-child(even)", PseudoClassNthChildEven },
+  { "nth-child(odd)", PseudoClassNthChildOdd },
+  { "selected", PseudoClassSelected },
+  { "single", PseudoClassSingle },
+};
+
+/**
+ * @return The PseudoClass for the given pattern.
+ */
+static PseudoClass pseudoClass(const char *pattern) {
+
+  for (size_t i = 0; i < lengthof(pseudoClasses); i++) {
+    if (strcmp(pseudoClasses[i].pattern, pattern) == 0) {
+      return pseudoClasses[i].pseudoClass;
+    }
+  }
+
+  return PseudoClassNone;
+}
+
+/**
+ * @brief Resolves the Class, class name Atom or PseudoClass of the given SimpleSelector, so that
+ * matching it does not require string comparisons.
+ */
+static void compile(SimpleSelector *simpleSelector) {
+
+  switch (simpleSelector->type) {
+    case SimpleSelectorTypeType:
+      simpleSelector->clazz = classForName(simpleSelector->pattern);
+      break;
+    case SimpleSelectorTypeClass:
+      simpleSelector->atom = MVC_Atom(simpleSelector->pattern);
+      break;
+    case SimpleSelectorTypePseudo:
+      simpleSelector->pseudoClass = pseudoClass(simpleSelector->pattern);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @fn SimpleSelector *SimpleSelector::initWithType(SimpleSelector *self, SimpleSelectorType type, const char *pattern)
+ * @memberof SimpleSelector
+ */
+static SimpleSelector *initWithType(SimpleSelector *self, SimpleSelectorType type, const char *pattern) {
+
+  assert(type);
+
+  self = $(self, initWithPattern, pattern);
+  if (self) {
+    self->type = type;
+    compile(self);
+  }
+
+  return self;
+}
+
 /**
  * @return The SimpleSelectorType for the given character.
  */
@@ -155,12 +227,9 @@ static Array *parse(const char *sequence) {
           strncpy(pattern, c, size);
         }
 
-        SimpleSelector *simpleSelector = $(alloc(SimpleSelector), initWithPattern, pattern);
+        SimpleSelector *simpleSelector = $(alloc(SimpleSelector), initWithType, simpleSelectorType(*delim), pattern);
         assert(simpleSelector);
 
-        simpleSelector->type = simpleSelectorType(*delim);
-        assert(simpleSelector->type);
-
         delim = c + size;
 
         $(simpleSelectors, addObject, simpleSelector);
@@ -190,6 +259,7 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->isEqual = isEqual;
 
   ((SimpleSelectorInterface *) clazz->interface)->initWithPattern = initWithPattern;
+  ((SimpleSelectorInterface *) clazz->interface)->initWithType = initWithType;
   ((SimpleSelectorInterface *) clazz->interface)->parse = parse;
 }
 
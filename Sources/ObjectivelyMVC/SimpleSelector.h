@@ -25,6 +25,7 @@
 
 #include <Objectively/Array.h>
 
+#include <ObjectivelyMVC/Atom.h>
 #include <ObjectivelyMVC/Types.h>
 
 /**
@@ -44,6 +45,27 @@ typedef enum {
   SimpleSelectorTypePseudo
 } SimpleSelectorType;
 
+/**
+ * @brief The pseudo-classes recognized by the framework.
+ * @remarks Pseudo-class SimpleSelectors are resolved to one of these at parse time, so that View
+ * and its subclasses may match them without comparing strings. Unrecognized pseudo-classes resolve
+ * to `PseudoClassNone`, and may still be matched by their pattern.
+ */
+typedef enum {
+  PseudoClassNone,
+  PseudoClassDisabled,
+  PseudoClassFirstChild,
+  PseudoClassFocused,
+  PseudoClassHighlighted,
+  PseudoClassHover,
+  PseudoClassLastChild,
+  PseudoClassMultiple,
+  PseudoClassNthChildEven,
+  PseudoClassNthChildOdd,
+  PseudoClassSelected,
+  PseudoClassSingle
+} PseudoClass;
+
 typedef struct SimpleSelector SimpleSelector;
 typedef struct SimpleSelectorInterface SimpleSelectorInterface;
 
@@ -74,6 +96,22 @@ struct SimpleSelector {
    * @brief The SimpleSelectorType.
    */
   SimpleSelectorType type;
+
+  /**
+   * @brief The Class, resolved at parse time for SimpleSelectorTypeType.
+   * @remarks This is `NULL` if the Class could not be resolved.
+   */
+  Class *clazz;
+
+  /**
+   * @brief The PseudoClass, resolved at parse time for SimpleSelectorTypePseudo.
+   */
+  PseudoClass pseudoClass;
+
+  /**
+   * @brief The class name Atom, resolved at parse time for SimpleSelectorTypeClass.
+   */
+  Atom atom;
 };
 
 /**
@@ -96,6 +134,18 @@ struct SimpleSelectorInterface {
    */
   SimpleSelector *(*initWithPattern)(SimpleSelector *self, const char *pattern);
 
+  /**
+   * @fn SimpleSelector *SimpleSelector::initWithType(SimpleSelector *self, SimpleSelectorType type, const char *pattern)
+   * @brief Initializes this SimpleSelector with the given type and pattern.
+   * @param self The SimpleSelector.
+   * @param type The SimpleSelectorType.
+   * @param pattern The pattern, without its leading delimiter.
+   * @return The initialized SimpleSelector, or `NULL` on error.
+   * @remarks This resolves the Class or PseudoClass of the SimpleSelector.
+   * @memberof SimpleSelector
+   */
+  SimpleSelector *(*initWithType)(SimpleSelector *self, SimpleSelectorType type, const char *pattern);
+
   /**
    * @static
    * @fn Array *SimpleSelector::parse(const char *sequence)
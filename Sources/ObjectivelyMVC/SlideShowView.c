@@ -25,6 +25,10 @@
 
 #include <SDL3/SDL_timer.h>
 
+#include <Objectively/String.h>
+
+#include "ImageRequest.h"
+#include "Log.h"
 #include "SlideShowView.h"
 
 #define _Class _SlideShowView
@@ -38,6 +42,14 @@ static void dealloc(Object *self) {
 
   SlideShowView *this = (SlideShowView *) self;
 
+  Array *names = $(this->requests, allKeys);
+  for (size_t i = 0; i < names->count; i++) {
+    ImageRequest *request = $(this->requests, objectForKey, names->elements[i]);
+    $(request, cancel);
+  }
+  release(names);
+
+  release(this->requests);
   release(this->images);
 
   super(Object, self, dealloc);
@@ -52,6 +64,103 @@ static View *init(View *self) {
   return (View *) $((SlideShowView *) self, initWithFrame, NULL);
 }
 
+/**
+ * @return The decoded Image for the slide at `index`, or `NULL` if it is not yet available.
+ */
+static Image *imageAtIndex(const SlideShowView *self, size_t index) {
+
+  const Array *images = (Array *) self->images;
+  const ident slide = images->elements[index % images->count];
+
+  if ($((Object *) slide, isKindOfClass, _Image())) {
+    return slide;
+  }
+
+  const ImageRequest *request = $(self->requests, objectForKey, slide);
+  if (request && $(request, isFinished)) {
+    return request->image;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Requests the slides within `lookahead` of the current slide, and cancels the rest.
+ */
+static void prefetch(SlideShowView *self) {
+
+  const Array *images = (Array *) self->images;
+  if (images->count == 0) {
+    return;
+  }
+
+  const size_t count = SDL_min(SDL_max(self->lookahead, 1) + 1, images->count);
+
+  Dictionary *requests = $$(Dictionary, dictionaryWithCapacity, count);
+  assert(requests);
+
+  for (size_t i = 0; i < count; i++) {
+
+    const ident slide = images->elements[(self->index + i) % images->count];
+    if ($((Object *) slide, isKindOfClass, _String())) {
+
+      ImageRequest *request = $(self->requests, objectForKey, slide);
+      if (request) {
+        $(requests, setObjectForKey, request, slide);
+      } else {
+        request = $$(ImageRequest, imageRequestWithResourceName, ((String *) slide)->chars);
+        $(requests, setObjectForKey, request, slide);
+        release(request);
+      }
+    }
+  }
+
+  Array *names = $(self->requests, allKeys);
+  for (size_t i = 0; i < names->count; i++) {
+    if ($(requests, objectForKey, names->elements[i]) == NULL) {
+      ImageRequest *request = $(self->requests, objectForKey, names->elements[i]);
+      $(request, cancel);
+    }
+  }
+  release(names);
+
+  release(self->requests);
+  self->requests = requests;
+}
+
+/**
+ * @brief Removes the slide at `index` if its Image failed to load.
+ * @return True if the slide was removed, false otherwise.
+ */
+static bool removeIfFailed(SlideShowView *self, size_t index) {
+
+  Array *images = self->images;
+  index = index % images->count;
+
+  const ident slide = images->elements[index];
+
+  const ImageRequest *request = $(self->requests, objectForKey, slide);
+  if (request == NULL || $(request, isFinished) == false || request->image) {
+    return false;
+  }
+
+  MVC_LogWarn("Removing slide %s\n", request->name);
+
+  $(self->requests, removeObjectForKey, slide);
+  $(images, removeObjectAtIndex, index);
+
+  if (index < self->index) {
+    self->index--;
+  }
+
+  if (self->index >= images->count) {
+    self->index = 0;
+  }
+
+  prefetch(self);
+  return true;
+}
+
 /**
  * @see View::render(View *, Renderer *)
  */
@@ -69,9 +178,13 @@ static void render(View *self, Renderer *renderer) {
   const Uint64 now = SDL_GetTicks();
 
   if (this->current->image == NULL) {
-    Image *first = $(images, firstObject);
-    $(this->current, setImage, first);
-    this->fadeEndedAt = now;
+    Image *first = imageAtIndex(this, this->index);
+    if (first) {
+      $(this->current, setImage, first);
+      this->fadeEndedAt = now;
+    } else {
+      removeIfFailed(this, this->index);
+    }
     return;
   }
 
@@ -79,21 +192,45 @@ static void render(View *self, Renderer *renderer) {
     return;
   }
 
+  if (this->next->image == NULL) {
+    Image *image = imageAtIndex(this, this->index + 1);
+    if (image) {
+      $(this->next, setImage, image);
+    } else if (removeIfFailed(this, this->index + 1)) {
+      return;
+    }
+  }
+
+  const bool fadeIn = ((View *) this->next)->subviewIndex > ((View *) this->current)->subviewIndex;
+
   if (this->fadeStartedAt) {
-    const float frac = (float) (now - this->fadeStartedAt) / (float) this->fadeDuration;
-    this->next->color.a = (Uint8) (SDL_min(frac, 1.f) * 255.f);
+    const float frac = SDL_min((float) (now - this->fadeStartedAt) / (float) this->fadeDuration, 1.f);
+    if (fadeIn) {
+      this->next->color.a = (Uint8) (frac * 255.f);
+    } else {
+      this->next->color.a = 255;
+      this->current->color.a = (Uint8) ((1.f - frac) * 255.f);
+    }
+
     if (frac >= 1.f) {
-      $(this->current, setImage, this->next->image);
-      $(this->next, setImage, NULL);
+      ImageView *current = this->current;
+      this->current = this->next;
+      this->next = current;
+
+      this->current->color.a = 255;
       this->next->color.a = 0;
+      $(this->next, setImage, NULL);
+
+      this->index = (this->index + 1) % images->count;
       this->fadeStartedAt = 0;
       this->fadeEndedAt = now;
+
+      prefetch(this);
     }
   } else if (now - this->fadeEndedAt >= this->slideDuration) {
-    this->index = (this->index + 1) % images->count;
-    Image *image = $(images, objectAtIndex, this->index);
-    $(this->next, setImage, image);
-    this->fadeStartedAt = now;
+    if (this->next->image) {
+      this->fadeStartedAt = now;
+    }
   }
 }
 
@@ -110,6 +247,23 @@ static void addImage(SlideShowView *self, Image *image) {
   $(self->images, addObject, image);
 }
 
+/**
+ * @fn void SlideShowView::addImageWithResourceName(SlideShowView *self, const char *name)
+ * @memberof SlideShowView
+ */
+static void addImageWithResourceName(SlideShowView *self, const char *name) {
+
+  assert(name);
+
+  String *string = $$(String, stringWithCharacters, name);
+  assert(string);
+
+  $(self->images, addObject, string);
+  release(string);
+
+  prefetch(self);
+}
+
 /**
  * @fn SlideShowView *SlideShowView::initWithFrame(SlideShowView *self, const SDL_Rect *frame)
  * @memberof SlideShowView
@@ -121,6 +275,11 @@ static SlideShowView *initWithFrame(SlideShowView *self, const SDL_Rect *frame)
     self->images = $(alloc(Array), init);
     assert(self->images);
 
+    self->requests = $$(Dictionary, dictionary);
+    assert(self->requests);
+
+    self->lookahead = 2;
+
     self->slideDuration = 5000;
     self->fadeDuration = 1000;
 
@@ -152,6 +311,7 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->init = init;
 
   ((SlideShowViewInterface *) clazz->interface)->addImage = addImage;
+  ((SlideShowViewInterface *) clazz->interface)->addImageWithResourceName = addImageWithResourceName;
   ((SlideShowViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
 }
 
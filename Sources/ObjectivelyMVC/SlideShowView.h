@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <Objectively/Dictionary.h>
+
 #include <ObjectivelyMVC/ImageView.h>
 #include <ObjectivelyMVC/View.h>
 
@@ -36,9 +38,14 @@ typedef struct SlideShowViewInterface SlideShowViewInterface;
 
 /**
  * @brief SlideShowView cycles through a collection of Images with crossfade transitions.
- * @details Add Image instances via `addImage`. The view starts displaying the first image
- * immediately upon arrival and advances to the next every `cycleInterval` milliseconds,
- * blending between images over `fadeDuration` milliseconds.
+ * @details Add Image instances via `addImage`, or Resource names via `addImageWithResourceName`.
+ * The view starts displaying the first image immediately upon arrival and advances to the next
+ * every `slideDuration` milliseconds, blending between images over `fadeDuration` milliseconds.
+ * @details Slides added by Resource name are decoded in the background, `lookahead` slides ahead
+ * of the current slide, and are released once they fall behind it. The next slide is uploaded
+ * while it is still transparent, so that the fade never waits on decoding or Texture creation.
+ * Slideshows with many large images should add them by Resource name, as Images added via
+ * `addImage` remain resident.
  * @extends View
  */
 struct SlideShowView {
@@ -55,7 +62,7 @@ struct SlideShowView {
   SlideShowViewInterface *interface;
 
   /**
-   * @brief The images to display.
+   * @brief The slides to display, as Images or Resource name Strings.
    * @protected
    */
   Array *images;
@@ -66,6 +73,18 @@ struct SlideShowView {
    */
   size_t index;
 
+  /**
+   * @brief The number of slides following the current slide to keep decoded.
+   * @remarks Values less than `1` are treated as `1`. The default is `2`.
+   */
+  size_t lookahead;
+
+  /**
+   * @brief The ImageRequests for the slides within `lookahead`, keyed by Resource name.
+   * @private
+   */
+  Dictionary *requests;
+
   /**
    * @brief The duration of each slide in milliseconds, excluding the fade transition.
    */
@@ -121,6 +140,16 @@ struct SlideShowViewInterface {
    */
   void (*addImage)(SlideShowView *self, Image *image);
 
+  /**
+   * @fn void SlideShowView::addImageWithResourceName(SlideShowView *self, const char *name)
+   * @brief Appends an Image to the slideshow by Resource name.
+   * @param self The SlideShowView.
+   * @param name The Resource name of the Image to add.
+   * @remarks The Image is decoded only while it is within `lookahead` of the current slide.
+   * @memberof SlideShowView
+   */
+  void (*addImageWithResourceName)(SlideShowView *self, const char *name);
+
   /**
    * @fn SlideShowView *SlideShowView::initWithFrame(SlideShowView *self, const SDL_Rect *frame)
    * @brief Initializes this SlideShowView with the specified frame.
@@ -49,13 +49,41 @@ static void applyStyle(View *self, const Style *style) {
 
   StackView *this = (StackView *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("axis", InletTypeEnum, &this->axis, (ident) StackViewAxisNames),
-    MakeInlet("distribution", InletTypeEnum, &this->distribution, (ident) StackViewDistributionNames),
-    MakeInlet("spacing", InletTypeInteger, &this->spacing, NULL)
-  );
+  for (size_t i = 0; i < style->numValues; i++) {
 
-  $(self, bind, inlets, (Dictionary *) style->attributes);
+    StyleValue *value = style->values[i];
+
+    switch (value->property) {
+      case StylePropertyAxis:
+        $(value, bind, InletTypeEnum, &this->axis, (ident) StackViewAxisNames);
+        break;
+      case StylePropertyDistribution:
+        $(value, bind, InletTypeEnum, &this->distribution, (ident) StackViewDistributionNames);
+        break;
+      case StylePropertySpacing:
+        $(value, bind, InletTypeInteger, &this->spacing, NULL);
+        break;
+      default:
+        continue;
+    }
+
+    self->needsLayout = true;
+  }
+}
+
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  StackView *this = (StackView *) self;
+  const StackView *that = (StackView *) prototype;
+
+  this->axis = that->axis;
+  this->distribution = that->distribution;
+  this->spacing = that->spacing;
 }
 
 /**
@@ -281,6 +309,7 @@ static StackView *initWithFrame(StackView *self, const SDL_Rect *frame) {
 static void initialize(Class *clazz) {
 
   ((ViewInterface *) clazz->interface)->applyStyle = applyStyle;
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
   ((ViewInterface *) clazz->interface)->init = init;
 
   ((ViewInterface *) clazz->interface)->layoutSubviews = layoutSubviews;
@@ -22,11 +22,13 @@
  */
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <Objectively.h>
 
+#include "Log.h"
 #include "Style.h"
 
 #define _Class _Style
@@ -43,6 +45,12 @@ static void dealloc(Object *self) {
   release(this->attributes);
   release(this->selectors);
 
+  for (size_t i = 0; i < this->numValues; i++) {
+    release(this->values[i]);
+  }
+
+  free(this->values);
+
   super(Object, self, dealloc);
 }
 
@@ -95,6 +103,90 @@ static bool isEqual(const Object *self, const Object *other) {
 
 #pragma mark - Style
 
+/**
+ * @return The index at which the given StyleProperty is, or would be, stored in `values`.
+ */
+static size_t indexOfProperty(const Style *self, StyleProperty property) {
+
+  size_t lo = 0, hi = self->numValues;
+
+  while (lo < hi) {
+    const size_t mid = (lo + hi) >> 1;
+    if (self->values[mid]->property < property) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+/**
+ * @brief Adds or replaces the given StyleValue.
+ */
+static void setValue(Style *self, StyleValue *value) {
+
+  const StyleProperty property = value->property;
+  const size_t index = indexOfProperty(self, property);
+
+  retain(value);
+
+  if (StyleHasProperty(self, property)) {
+    release(self->values[index]);
+    self->values[index] = value;
+    return;
+  }
+
+  if (self->numValues == self->maxValues) {
+    self->maxValues = self->maxValues ? self->maxValues << 1 : 8;
+    self->values = realloc(self->values, self->maxValues * sizeof(StyleValue *));
+    assert(self->values);
+  }
+
+  memmove(self->values + index + 1, self->values + index, (self->numValues - index) * sizeof(StyleValue *));
+
+  self->values[index] = value;
+  self->numValues++;
+
+  self->properties[property >> 6] |= (1ull << (property & 63));
+}
+
+/**
+ * @brief Removes the StyleValue for the given StyleProperty, if present.
+ */
+static void removeValue(Style *self, StyleProperty property) {
+
+  if (property == StylePropertyNone || !StyleHasProperty(self, property)) {
+    return;
+  }
+
+  const size_t index = indexOfProperty(self, property);
+
+  release(self->values[index]);
+
+  self->numValues--;
+  memmove(self->values + index, self->values + index + 1, (self->numValues - index) * sizeof(StyleValue *));
+
+  self->properties[property >> 6] &= ~(1ull << (property & 63));
+}
+
+/**
+ * @brief Resolves and adds a StyleValue for the given attribute.
+ */
+static void addValue(Style *self, const char *attr, ident value) {
+
+  const StyleProperty property = MVC_StylePropertyForName(attr);
+  if (property != StylePropertyNone) {
+
+    StyleValue *styleValue = $(alloc(StyleValue), initWithProperty, property, value);
+    assert(styleValue);
+
+    setValue(self, styleValue);
+    release(styleValue);
+  }
+}
+
 /**
  * @fn void Style::addAttribute(Style *self, const char *attr, ident value)
  * @memberof Style
@@ -109,6 +201,8 @@ static void addAttribute(Style *self, const char *attr, ident value) {
 
   $((Dictionary *) self->attributes, setObjectForKeyPath, value, key);
 
+  addValue(self, key, value);
+
   free(key);
 }
 
@@ -121,6 +215,30 @@ static void addAttributes(Style *self, const Dictionary *attributes) {
   assert(attributes);
 
   $((Dictionary *) self->attributes, addEntriesFromDictionary, attributes);
+
+  Array *keys = $(attributes, allKeys);
+  for (size_t i = 0; i < keys->count; i++) {
+
+    const String *key = $(keys, objectAtIndex, i);
+    addValue(self, key->chars, $(attributes, objectForKey, key));
+  }
+
+  release(keys);
+}
+
+/**
+ * @fn void Style::addAttributesFromStyle(Style *self, const Style *style)
+ * @memberof Style
+ */
+static void addAttributesFromStyle(Style *self, const Style *style) {
+
+  assert(style);
+
+  $((Dictionary *) self->attributes, addEntriesFromDictionary, style->attributes);
+
+  for (size_t i = 0; i < style->numValues; i++) {
+    setValue(self, style->values[i]);
+  }
 }
 
 /**
@@ -285,6 +403,19 @@ static ident attributeValue(const Style *self, const char *attr) {
   return $((Dictionary *) self->attributes, objectForKeyPath, attr);
 }
 
+/**
+ * @fn StyleValue *Style::valueForProperty(const Style *self, StyleProperty property)
+ * @memberof Style
+ */
+static StyleValue *valueForProperty(const Style *self, StyleProperty property) {
+
+  if (property == StylePropertyNone || !StyleHasProperty(self, property)) {
+    return NULL;
+  }
+
+  return self->values[indexOfProperty(self, property)];
+}
+
 /**
  * @fn Style *Style::initWithAttributes(Style *self, const Dictionary *attributes)
  * @memberof Style
@@ -351,100 +482,218 @@ static bool isComputedEqual(const Style *self, const Style *other) {
 }
 
 /**
- * @return The value Object parsed from the given String.
+ * @brief A growable character buffer, reused for every token of a parse.
  */
-static ident parseValue(String *string) {
+typedef struct {
+  char *chars;
+  size_t length;
+  size_t capacity;
+} CSSBuffer;
 
-  ident value = NULL;
+/**
+ * @brief A single-pass tokenizer over a null-terminated buffer of CSS definitions.
+ */
+typedef struct {
 
-  assert(string);
+  /**
+   * @brief The read position.
+   */
+  const char *c;
 
-  String *trimmed = $(string, trimmedString);
-  assert(trimmed);
+  /**
+   * @brief The line and column of the read position, for error reporting.
+   */
+  int line, column;
 
-  StringReader *reader = $(alloc(StringReader), initWithString, trimmed);
-  assert(reader);
+  /**
+   * @brief The buffers for selector rules and attribute names, and for attribute values.
+   */
+  CSSBuffer token, value;
+} CSSTokenizer;
 
-  const Unicode *charset = L", \n\t";
-  Unicode stop;
+/**
+ * @brief Appends the character `c` to `buffer`.
+ */
+static void appendCharacter(CSSBuffer *buffer, char c) {
 
-  String *token = $(reader, readToken, charset, &stop);
-  if (token) {
+  if (buffer->length + 1 >= buffer->capacity) {
+    buffer->capacity = buffer->capacity ? buffer->capacity << 1 : 256;
+    buffer->chars = realloc(buffer->chars, buffer->capacity);
+    assert(buffer->chars);
+  }
 
-    NumberFormatter *formatter = $(alloc(NumberFormatter), initWithFormat, NULL);
-    assert(formatter);
+  buffer->chars[buffer->length++] = c;
+}
 
-    Number *number = $(formatter, numberFromString, token);
+/**
+ * @brief Advances the tokenizer by `count` characters, tracking lines and columns.
+ */
+static void advance(CSSTokenizer *tokenizer, size_t count) {
 
-    if (stop == READER_EOF) {
+  while (count-- && *tokenizer->c) {
+    if (*tokenizer->c == '\n') {
+      tokenizer->line++;
+      tokenizer->column = 1;
+    } else {
+      tokenizer->column++;
+    }
+    tokenizer->c++;
+  }
+}
 
-      if (number) {
-        value = retain(number);
-      } else if (strcmp("true", token->chars) == 0) {
-        value = retain($$(Boole, True));
-      } else if (strcmp("false", token->chars) == 0) {
-        value = retain($$(Boole, False));
-      } else {
-        value = $((Object *) token, copy);
-      }
+/**
+ * @brief Skips the comment at the read position, if any.
+ * @return True if a comment was skipped, false otherwise.
+ */
+static bool skipComment(CSSTokenizer *tokenizer) {
 
-    } else if (number) {
-      value = $$(Array, arrayWithCapacity, 4);
+  if (tokenizer->c[0] == '/' && tokenizer->c[1] == '*') {
 
-      while (token) {
+    const int line = tokenizer->line, column = tokenizer->column;
 
-        Object *obj = parseValue(token);
-        $((Array *) value, addObject, obj);
-        release(obj);
-        release(token);
+    advance(tokenizer, 2);
 
-        token = $(reader, readToken, charset, NULL);
-      }
+    while (*tokenizer->c && !(tokenizer->c[0] == '*' && tokenizer->c[1] == '/')) {
+      advance(tokenizer, 1);
+    }
+
+    if (*tokenizer->c) {
+      advance(tokenizer, 2);
     } else {
-      value = retain(trimmed);
+      MVC_LogWarn("%d:%d: Unterminated comment\n", line, column);
     }
 
-    release(number);
-    release(formatter);
-    release(token);
+    return true;
   }
 
-  release(reader);
-  release(trimmed);
-
-  return value;
+  return false;
 }
 
 /**
- * @brief Returns a newly allocated copy of `css` with all `/ * ... * /` comments
- * removed. The tokenizer below splits on `{ : ; }` and has no notion of comments,
- * so a comment absorbed into a selector or declaration silently corrupts the rule.
- * Each comment is replaced by a single space so it still separates adjacent tokens.
- * The caller must free the returned buffer.
+ * @brief Reads the next token, up to any of `delimiters`, into `buffer`.
+ * @details Leading and trailing whitespace is trimmed, and comments are replaced by a single
+ * space so that they still separate adjacent words.
+ * @return The delimiter that terminated the token, which is consumed, or `'\0'` at end of input.
  */
-static char *stripComments(const char *css) {
+static char readToken(CSSTokenizer *tokenizer, const char *delimiters, CSSBuffer *buffer) {
 
-  const size_t len = strlen(css);
+  buffer->length = 0;
 
-  char *out = calloc(1, len + 1);
-  assert(out);
+  while (*tokenizer->c) {
+    if (isspace((unsigned char) *tokenizer->c)) {
+      advance(tokenizer, 1);
+    } else if (!skipComment(tokenizer)) {
+      break;
+    }
+  }
 
-  size_t w = 0;
-  for (size_t r = 0; r < len; ) {
-    if (css[r] == '/' && css[r + 1] == '*') {
-      r += 2;
-      while (r < len && !(css[r] == '*' && css[r + 1] == '/')) {
-        r++;
-      }
-      r = (r < len) ? r + 2 : len;
-      out[w++] = ' ';
+  while (*tokenizer->c && strchr(delimiters, *tokenizer->c) == NULL) {
+    if (skipComment(tokenizer)) {
+      appendCharacter(buffer, ' ');
     } else {
-      out[w++] = css[r++];
+      appendCharacter(buffer, *tokenizer->c);
+      advance(tokenizer, 1);
     }
   }
 
-  out[w] = '\0';
-  return out;
+  while (buffer->length && isspace((unsigned char) buffer->chars[buffer->length - 1])) {
+    buffer->length--;
+  }
+
+  appendCharacter(buffer, '\0');
+  buffer->length--;
+
+  const char stop = *tokenizer->c;
+  if (stop) {
+    advance(tokenizer, 1);
+  }
+
+  return stop;
+}
+
+/**
+ * @return True if `token` is entirely a decimal number, false otherwise.
+ */
+static bool isNumeric(const char *token) {
+
+  if (strchr("+-.0123456789", *token) == NULL || *token == '\0') {
+    return false;
+  }
+
+  char *end;
+  strtod(token, &end);
+
+  return end != token && *end == '\0';
+}
+
+/**
+ * @return The value Object for the given, whitespace-free, token.
+ */
+static ident parseScalar(const char *token) {
+
+  if (isNumeric(token)) {
+    return $$(Number, numberWithValue, strtod(token, NULL));
+  } else if (strcmp("true", token) == 0) {
+    return retain($$(Boole, True));
+  } else if (strcmp("false", token) == 0) {
+    return retain($$(Boole, False));
+  } else {
+    return $$(String, stringWithCharacters, token);
+  }
+}
+
+/**
+ * @return The value Object parsed from the given trimmed value, which is modified in place.
+ * @remarks Values consisting of a single token are parsed as a Number, Boole or String. Values
+ * comprised of several tokens, the first of which is numeric, are parsed as an Array. Any other
+ * value is parsed as a String.
+ */
+static ident parseValue(char *chars) {
+
+  static const char *delimiters = ", \n\t";
+
+  if (*chars == '\0') {
+    return NULL;
+  }
+
+  const size_t length = strcspn(chars, delimiters);
+  if (chars[length] == '\0') {
+    return parseScalar(chars);
+  }
+
+  const char delimiter = chars[length];
+  chars[length] = '\0';
+  const bool numeric = isNumeric(chars);
+  chars[length] = delimiter;
+
+  if (numeric == false) {
+    return $$(String, stringWithCharacters, chars);
+  }
+
+  Array *array = $$(Array, arrayWithCapacity, 4);
+  assert(array);
+
+  char *token = chars;
+  while (*token) {
+
+    const size_t size = strcspn(token, delimiters);
+    if (size) {
+
+      const char delimiter = token[size];
+      token[size] = '\0';
+
+      ident obj = parseScalar(token);
+      $(array, addObject, obj);
+      release(obj);
+
+      token[size] = delimiter;
+    }
+
+    token += size;
+    token += strspn(token, delimiters);
+  }
+
+  return array;
 }
 
 /**
@@ -458,60 +707,82 @@ static Array *parse(const char *css) {
 
   if (css) {
 
-    char *stripped = stripComments(css);
+    CSSTokenizer tokenizer = {
+      .c = css,
+      .line = 1,
+      .column = 1
+    };
 
-    StringReader *reader = $(alloc(StringReader), initWithCharacters, stripped);
-    assert(reader);
+    while (*tokenizer.c) {
 
-    Style *style = NULL;
-    char *attr = NULL;
+      const int line = tokenizer.line, column = tokenizer.column;
 
-    while (true) {
+      char stop = readToken(&tokenizer, "{}", &tokenizer.token);
+      if (stop == '\0') {
+        if (tokenizer.token.length) {
+          MVC_LogWarn("%d:%d: Expected '{' after `%s`\n", line, column, tokenizer.token.chars);
+        }
+        break;
+      }
 
-      const Unicode *charset = style ? L"{:;}" : L"{}";
-      Unicode stop;
+      if (stop == '}') {
+        MVC_LogWarn("%d:%d: Unexpected '}'\n", tokenizer.line, tokenizer.column - 1);
+        continue;
+      }
 
-      String *token = $(reader, readToken, charset, &stop);
-      if (token) {
-        switch (stop) {
-          case '{':
-            style = $(alloc(Style), initWithRules, token->chars);
-            assert(style);
-            break;
-          case ':':
-            if (style) {
-              attr = strtrim(token->chars);
-              assert(attr);
-            }
-            break;
-          case ';':
-            if (style && attr) {
+      Style *style = NULL;
+      if (tokenizer.token.length) {
+        style = $(alloc(Style), initWithRules, tokenizer.token.chars);
+        assert(style);
+      } else {
+        MVC_LogWarn("%d:%d: Expected selector before '{'\n", line, column);
+      }
+
+      while (true) {
 
-              ident value = parseValue(token);
-              $(style, addAttribute, attr, value);
+        const int attrLine = tokenizer.line, attrColumn = tokenizer.column;
 
-              free(attr);
-              attr = NULL;
+        stop = readToken(&tokenizer, ":;}", &tokenizer.token);
+        if (stop == ':') {
 
+          stop = readToken(&tokenizer, ";}", &tokenizer.value);
+
+          if (tokenizer.token.length == 0) {
+            MVC_LogWarn("%d:%d: Expected attribute name before ':'\n", attrLine, attrColumn);
+          } else if (style) {
+            ident value = parseValue(tokenizer.value.chars);
+            if (value) {
+              $(style, addAttribute, tokenizer.token.chars, value);
               release(value);
+            } else {
+              MVC_LogWarn("%d:%d: Expected value for `%s`\n", attrLine, attrColumn, tokenizer.token.chars);
             }
-            break;
-          case '}':
-            if (style) {
-              $(styles, addObject, style);
-              style = release(style);
-            }
-            break;
+          }
+
+        } else if (tokenizer.token.length) {
+          MVC_LogWarn("%d:%d: Expected ':' after `%s`\n", attrLine, attrColumn, tokenizer.token.chars);
         }
 
-        release(token);
-      } else {
-        break;
+        if (stop == '}') {
+          if (style) {
+            $(styles, addObject, style);
+          }
+          break;
+        }
+
+        if (stop == '\0') {
+          MVC_LogWarn("%d:%d: Unterminated block\n", tokenizer.line, tokenizer.column);
+          break;
+        }
+      }
+
+      if (style) {
+        release(style);
       }
     }
 
-    release(reader);
-    free(stripped);
+    free(tokenizer.token.chars);
+    free(tokenizer.value.chars);
   }
 
   return (Array *) styles;
@@ -522,7 +793,10 @@ static Array *parse(const char *css) {
  * @memberof Style
  */
 static void removeAttribute(Style *self, const char *attr) {
+
   $((Dictionary *) self->attributes, removeObjectForKeyPath, attr);
+
+  removeValue(self, MVC_StylePropertyForName(attr));
 }
 
 /**
@@ -530,7 +804,15 @@ static void removeAttribute(Style *self, const char *attr) {
  * @memberof Style
  */
 static void removeAllAttributes(Style *self) {
+
   $((Dictionary *) self->attributes, removeAllObjects);
+
+  for (size_t i = 0; i < self->numValues; i++) {
+    release(self->values[i]);
+  }
+
+  self->numValues = 0;
+  memset(self->properties, 0, sizeof(self->properties));
 }
 
 #pragma mark - Class lifecycle
@@ -547,6 +829,7 @@ static void initialize(Class *clazz) {
 
   ((StyleInterface *) clazz->interface)->addAttribute = addAttribute;
   ((StyleInterface *) clazz->interface)->addAttributes = addAttributes;
+  ((StyleInterface *) clazz->interface)->addAttributesFromStyle = addAttributesFromStyle;
   ((StyleInterface *) clazz->interface)->addBoolAttribute = addBoolAttribute;
   ((StyleInterface *) clazz->interface)->addCharactersAttribute = addCharactersAttribute;
   ((StyleInterface *) clazz->interface)->addColorAttribute = addColorAttribute;
@@ -565,6 +848,7 @@ static void initialize(Class *clazz) {
   ((StyleInterface *) clazz->interface)->parse = parse;
   ((StyleInterface *) clazz->interface)->removeAllAttributes = removeAllAttributes;
   ((StyleInterface *) clazz->interface)->removeAttribute = removeAttribute;
+  ((StyleInterface *) clazz->interface)->valueForProperty = valueForProperty;
 }
 
 /**
@@ -27,6 +27,7 @@
 #include <Objectively/Dictionary.h>
 
 #include <ObjectivelyMVC/Selector.h>
+#include <ObjectivelyMVC/StyleValue.h>
 
 /**
  * @file
@@ -58,12 +59,40 @@ struct Style {
    */
   Dictionary *attributes;
 
+  /**
+   * @brief A bitmask of the StyleProperties present in this Style.
+   */
+  uint64_t properties[STYLE_PROPERTY_MAX / 64];
+
   /**
    * @brief The Selectors.
    */
   Array *selectors;
+
+  /**
+   * @brief The StyleValues of the attributes, ordered by StyleProperty.
+   * @remarks Each StyleValue corresponds to a bit set in `properties`.
+   */
+  StyleValue **values;
+
+  /**
+   * @brief The count of `values`.
+   */
+  size_t numValues;
+
+  /**
+   * @brief The capacity of `values`.
+   * @private
+   */
+  size_t maxValues;
 };
 
+/**
+ * @return True if the given Style contains the given StyleProperty, false otherwise.
+ */
+#define StyleHasProperty(style, property) \
+  (((style)->properties[(property) >> 6] >> ((property) & 63)) & 1)
+
 /**
  * @brief The Style interface.
  */
@@ -94,6 +123,17 @@ struct StyleInterface {
    */
   void (*addAttributes)(Style *self, const Dictionary *attributes);
 
+  /**
+   * @fn void Style::addAttributesFromStyle(Style *self, const Style *style)
+   * @brief Adds or replaces the attributes of `style` to this Style.
+   * @param self The Style.
+   * @param style The Style.
+   * @remarks The StyleValues of `style` are shared rather than resolved again, which makes this
+   * the preferred method for computing Styles.
+   * @memberof Style
+   */
+  void (*addAttributesFromStyle)(Style *self, const Style *style);
+
   /**
    * @fn void Style::addBoolAttribute(Style *self, const char *attr, bool value)
    * @brief Adds or replaces the given attribute with `value`.
@@ -213,6 +253,15 @@ struct StyleInterface {
    */
   ident (*attributeValue)(const Style *self, const char *attr);
 
+  /**
+   * @fn StyleValue *Style::valueForProperty(const Style *self, StyleProperty property)
+   * @param self The Style.
+   * @param property The StyleProperty.
+   * @return The StyleValue for the given StyleProperty, or `NULL`.
+   * @memberof Style
+   */
+  StyleValue *(*valueForProperty)(const Style *self, StyleProperty property);
+
   /**
    * @fn Style *Style::initWithAttributes(Style *self, const Dictionary *attributes)
    * @brief Initializes this Style with the given attributes.
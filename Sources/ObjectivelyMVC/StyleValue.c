@@ -0,0 +1,356 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include "Colors.h"
+#include "StyleValue.h"
+
+#define _Class _StyleValue
+
+/**
+ * @brief The size of the StyleProperty hash table.
+ */
+#define STYLE_PROPERTY_TABLE_SIZE (STYLE_PROPERTY_MAX << 1)
+
+/**
+ * @brief The names of the registered StyleProperties.
+ */
+static const char *_names[STYLE_PROPERTY_MAX] = {
+  [StylePropertyAlignment] = "alignment",
+  [StylePropertyAutoresizingMask] = "autoresizing-mask",
+  [StylePropertyAxis] = "axis",
+  [StylePropertyBackgroundColor] = "background-color",
+  [StylePropertyBevel] = "bevel",
+  [StylePropertyBorderColor] = "border-color",
+  [StylePropertyBorderWidth] = "border-width",
+  [StylePropertyClipsSubviews] = "clips-subviews",
+  [StylePropertyColor] = "color",
+  [StylePropertyDistribution] = "distribution",
+  [StylePropertyDraggable] = "draggable",
+  [StylePropertyEditable] = "editable",
+  [StylePropertyFontFamily] = "font-family",
+  [StylePropertyFontSize] = "font-size",
+  [StylePropertyFontStyle] = "font-style",
+  [StylePropertyFrame] = "frame",
+  [StylePropertyHeight] = "height",
+  [StylePropertyHidden] = "hidden",
+  [StylePropertyItemSize] = "item-size",
+  [StylePropertyItemSpacing] = "item-spacing",
+  [StylePropertyLeft] = "left",
+  [StylePropertyMaxSize] = "max-size",
+  [StylePropertyMaxHeight] = "max-height",
+  [StylePropertyMaxWidth] = "max-width",
+  [StylePropertyMinSize] = "min-size",
+  [StylePropertyMinHeight] = "min-height",
+  [StylePropertyMinWidth] = "min-width",
+  [StylePropertyPadding] = "padding",
+  [StylePropertyPaddingBottom] = "padding-bottom",
+  [StylePropertyPaddingLeft] = "padding-left",
+  [StylePropertyPaddingRight] = "padding-right",
+  [StylePropertyPaddingTop] = "padding-top",
+  [StylePropertyResizable] = "resizable",
+  [StylePropertyScrollbar] = "scrollbar",
+  [StylePropertySelection] = "selection",
+  [StylePropertySpacing] = "spacing",
+  [StylePropertyTop] = "top",
+  [StylePropertyWidth] = "width",
+};
+
+/**
+ * @brief The number of registered StyleProperties.
+ */
+static int _count = StylePropertyApplicationDefined;
+
+/**
+ * @brief The StyleProperty hash table, open addressed, storing StyleProperty + 1.
+ */
+static int16_t _table[STYLE_PROPERTY_TABLE_SIZE];
+
+/**
+ * @brief Inserts the given StyleProperty into the hash table.
+ */
+static void insertStyleProperty(StyleProperty property) {
+
+  size_t i = (unsigned int) HashForCString(HASH_SEED, _names[property]) % STYLE_PROPERTY_TABLE_SIZE;
+
+  while (_table[i]) {
+    i = (i + 1) % STYLE_PROPERTY_TABLE_SIZE;
+  }
+
+  _table[i] = property + 1;
+}
+
+StyleProperty MVC_StylePropertyForName(const char *name) {
+
+  static Once once;
+
+  do_once(&once, {
+    for (int i = 0; i < _count; i++) {
+      insertStyleProperty(i);
+    }
+  });
+
+  assert(name);
+
+  size_t i = (unsigned int) HashForCString(HASH_SEED, name) % STYLE_PROPERTY_TABLE_SIZE;
+
+  while (_table[i]) {
+    const StyleProperty property = _table[i] - 1;
+    if (strcmp(_names[property], name) == 0) {
+      return property;
+    }
+    i = (i + 1) % STYLE_PROPERTY_TABLE_SIZE;
+  }
+
+  if (_count == STYLE_PROPERTY_MAX) {
+    return StylePropertyNone;
+  }
+
+  const StyleProperty property = _count++;
+
+  _names[property] = strdup(name);
+  assert(_names[property]);
+
+  _table[i] = property + 1;
+
+  return property;
+}
+
+const char *MVC_StylePropertyName(StyleProperty property) {
+
+  if (property > StylePropertyNone && property < _count) {
+    return _names[property];
+  }
+
+  return NULL;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  StyleValue *this = (StyleValue *) self;
+
+  release(this->value);
+
+  super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+  const StyleValue *this = (StyleValue *) self;
+
+  return $((Object *) this->value, description);
+}
+
+#pragma mark - StyleValue
+
+/**
+ * @fn void StyleValue::bind(StyleValue *self, InletType type, ident dest, ident data)
+ * @memberof StyleValue
+ */
+static void bind(StyleValue *self, InletType type, ident dest, ident data) {
+
+  assert(dest);
+
+  if (self->inletTypes & (1 << type)) {
+    switch (type) {
+      case InletTypeBool:
+        *(bool *) dest = self->boolean;
+        return;
+      case InletTypeColor:
+        *(SDL_Color *) dest = self->color;
+        return;
+      case InletTypeDouble:
+        *(double *) dest = self->number;
+        return;
+      case InletTypeFloat:
+        *(float *) dest = self->number;
+        return;
+      case InletTypeInteger:
+        *(int *) dest = self->number;
+        return;
+      case InletTypePoint:
+        *(SDL_Point *) dest = self->point;
+        return;
+      case InletTypeRectangle:
+        *(SDL_Rect *) dest = self->rect;
+        return;
+      case InletTypeSize:
+        *(SDL_Size *) dest = MakeSize(self->point.x, self->point.y);
+        return;
+      default:
+        break;
+    }
+  }
+
+  if (type == InletTypeEnum && data) {
+    if (self->names != data) {
+      self->enumValue = valueof(data, cast(String, self->value)->chars);
+      self->names = data;
+    }
+    *(int *) dest = self->enumValue;
+    return;
+  }
+
+  const Inlet inlet = MakeInlet(MVC_StylePropertyName(self->property), type, dest, data);
+  BindInlet(&inlet, self->value);
+}
+
+/**
+ * @return True if all elements of the given Array are Numbers, false otherwise.
+ */
+static bool isNumericArray(const Array *array) {
+
+  for (size_t i = 0; i < array->count; i++) {
+    if (!$((Object *) array->elements[i], isKindOfClass, _Number())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Scales normalized color components to bytes, as the InletTypeColor binding does.
+ */
+#define ScaleColor(c) ((c) > 0.0 && (c) < 1.0 ? (c) * 255 : (c))
+
+/**
+ * @fn StyleValue *StyleValue::initWithProperty(StyleValue *self, StyleProperty property, ident value)
+ * @memberof StyleValue
+ */
+static StyleValue *initWithProperty(StyleValue *self, StyleProperty property, ident value) {
+
+  assert(value);
+
+  self = (StyleValue *) super(Object, self, init);
+  if (self) {
+
+    self->property = property;
+    self->value = retain(value);
+
+    const Object *object = value;
+
+    if ($(object, isKindOfClass, _Boole())) {
+
+      self->boolean = ((Boole *) object)->value;
+      self->inletTypes |= (1 << InletTypeBool);
+
+    } else if ($(object, isKindOfClass, _Number())) {
+
+      self->number = ((Number *) object)->value;
+      self->rect = MakeRect(self->number, self->number, self->number, self->number);
+      self->inletTypes |= (1 << InletTypeDouble) | (1 << InletTypeFloat) | (1 << InletTypeInteger);
+      self->inletTypes |= (1 << InletTypeRectangle);
+
+    } else if ($(object, isKindOfClass, _String())) {
+
+      const String *string = (String *) object;
+
+      if (string->length == 0) {
+        self->color = Colors.Black;
+        self->inletTypes |= (1 << InletTypeColor);
+      } else if (string->chars[0] == '#') {
+        self->color = MVC_HexToRGBA(string->chars + 1);
+        self->inletTypes |= (1 << InletTypeColor);
+      } else if (strcmp("none", string->chars)) {
+        self->color = MVC_ColorForName(string->chars);
+        self->inletTypes |= (1 << InletTypeColor);
+      }
+
+    } else if ($(object, isKindOfClass, _Array())) {
+
+      const Array *array = (Array *) object;
+      if (isNumericArray(array)) {
+
+        const Number **n = (const Number **) array->elements;
+
+        if (array->count == 2) {
+          self->point = MakePoint(n[0]->value, n[1]->value);
+          self->inletTypes |= (1 << InletTypePoint) | (1 << InletTypeSize);
+        } else if (array->count == 4) {
+          self->rect = MakeRect(n[0]->value, n[1]->value, n[2]->value, n[3]->value);
+          self->color = MakeColor(
+            ScaleColor(n[0]->value),
+            ScaleColor(n[1]->value),
+            ScaleColor(n[2]->value),
+            ScaleColor(n[3]->value)
+          );
+          self->inletTypes |= (1 << InletTypeRectangle) | (1 << InletTypeColor);
+        }
+      }
+    }
+  }
+
+  return self;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+  ((ObjectInterface *) clazz->interface)->description = description;
+
+  ((StyleValueInterface *) clazz->interface)->bind = bind;
+  ((StyleValueInterface *) clazz->interface)->initWithProperty = initWithProperty;
+}
+
+/**
+ * @fn Class *StyleValue::_StyleValue(void)
+ * @memberof StyleValue
+ */
+Class *_StyleValue(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "StyleValue",
+      .superclass = _Object(),
+      .instanceSize = sizeof(StyleValue),
+      .interfaceOffset = offsetof(StyleValue, interface),
+      .interfaceSize = sizeof(StyleValueInterface),
+      .initialize = initialize,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
@@ -0,0 +1,222 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Enum.h>
+
+#include <ObjectivelyMVC/View+JSON.h>
+
+/**
+ * @file
+ * @brief The StyleValue type and the Style property registry.
+ */
+
+/**
+ * @brief Style property identifiers.
+ * @details The properties bound by the framework's own Views are assigned fixed identifiers,
+ * so that View::applyStyle may switch on them. Any other attribute name is assigned an identifier
+ * at or beyond `StylePropertyApplicationDefined` the first time it is seen.
+ * @remarks Shorthand properties precede their components, so that components take precedence
+ * when a Style is applied in order.
+ */
+typedef enum {
+  StylePropertyNone = -1,
+  StylePropertyAlignment,
+  StylePropertyAutoresizingMask,
+  StylePropertyAxis,
+  StylePropertyBackgroundColor,
+  StylePropertyBevel,
+  StylePropertyBorderColor,
+  StylePropertyBorderWidth,
+  StylePropertyClipsSubviews,
+  StylePropertyColor,
+  StylePropertyDistribution,
+  StylePropertyDraggable,
+  StylePropertyEditable,
+  StylePropertyFontFamily,
+  StylePropertyFontSize,
+  StylePropertyFontStyle,
+  StylePropertyFrame,
+  StylePropertyHeight,
+  StylePropertyHidden,
+  StylePropertyItemSize,
+  StylePropertyItemSpacing,
+  StylePropertyLeft,
+  StylePropertyMaxSize,
+  StylePropertyMaxHeight,
+  StylePropertyMaxWidth,
+  StylePropertyMinSize,
+  StylePropertyMinHeight,
+  StylePropertyMinWidth,
+  StylePropertyPadding,
+  StylePropertyPaddingBottom,
+  StylePropertyPaddingLeft,
+  StylePropertyPaddingRight,
+  StylePropertyPaddingTop,
+  StylePropertyResizable,
+  StylePropertyScrollbar,
+  StylePropertySelection,
+  StylePropertySpacing,
+  StylePropertyTop,
+  StylePropertyWidth,
+  StylePropertyApplicationDefined
+} StyleProperty;
+
+/**
+ * @brief The maximum number of distinct Style properties.
+ */
+#define STYLE_PROPERTY_MAX 256
+
+/**
+ * @brief Resolves the StyleProperty for the given attribute name, registering it if necessary.
+ * @param name The attribute name, e.g. `"background-color"`.
+ * @return The StyleProperty, or `StylePropertyNone` if the registry is full.
+ * @remarks The registry is not thread safe; Styles should be created on the main thread.
+ */
+OBJECTIVELYMVC_EXPORT StyleProperty MVC_StylePropertyForName(const char *name);
+
+/**
+ * @param property The StyleProperty.
+ * @return The attribute name of the given StyleProperty, or `NULL`.
+ */
+OBJECTIVELYMVC_EXPORT const char *MVC_StylePropertyName(StyleProperty property);
+
+typedef struct StyleValue StyleValue;
+typedef struct StyleValueInterface StyleValueInterface;
+
+/**
+ * @brief StyleValues are typed representations of Style attributes.
+ * @details Colors, numbers, points, sizes and rectangles are resolved once, when the attribute
+ * is added to a Style, so that applying a Style is a matter of copying values. Enums are resolved
+ * the first time they are bound, and cached for the EnumNames they were bound with.
+ * @extends Object
+ * @ingroup Theme
+ */
+struct StyleValue {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  StyleValueInterface *interface;
+
+  /**
+   * @brief The StyleProperty.
+   */
+  StyleProperty property;
+
+  /**
+   * @brief The attribute value, as parsed.
+   */
+  ident value;
+
+  /**
+   * @brief A bitmask of the InletTypes for which this StyleValue is resolved.
+   */
+  int inletTypes;
+
+  /**
+   * @brief The resolved boolean value.
+   */
+  bool boolean;
+
+  /**
+   * @brief The resolved numeric value.
+   */
+  double number;
+
+  /**
+   * @brief The resolved color value.
+   */
+  SDL_Color color;
+
+  /**
+   * @brief The resolved point or size value.
+   */
+  SDL_Point point;
+
+  /**
+   * @brief The resolved rectangle value.
+   */
+  SDL_Rect rect;
+
+  /**
+   * @brief The EnumNames for which `enumValue` was resolved.
+   * @private
+   */
+  const EnumName *names;
+
+  /**
+   * @brief The resolved enum value.
+   * @private
+   */
+  int enumValue;
+};
+
+/**
+ * @brief The StyleValue interface.
+ */
+struct StyleValueInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn void StyleValue::bind(StyleValue *self, InletType type, ident dest, ident data)
+   * @brief Binds this StyleValue to the given destination.
+   * @param self The StyleValue.
+   * @param type The InletType.
+   * @param dest The Inlet destination.
+   * @param data The Inlet data, e.g. an array of EnumNames.
+   * @remarks Unresolved types fall back to the InletBinding for `type`.
+   * @memberof StyleValue
+   */
+  void (*bind)(StyleValue *self, InletType type, ident dest, ident data);
+
+  /**
+   * @fn StyleValue *StyleValue::initWithProperty(StyleValue *self, StyleProperty property, ident value)
+   * @brief Initializes this StyleValue, resolving `value` for all applicable InletTypes.
+   * @param self The StyleValue.
+   * @param property The StyleProperty.
+   * @param value The attribute value.
+   * @return The initialized StyleValue, or `NULL` on error.
+   * @memberof StyleValue
+   */
+  StyleValue *(*initWithProperty)(StyleValue *self, StyleProperty property, ident value);
+};
+
+/**
+ * @fn Class *StyleValue::_StyleValue(void)
+ * @brief The StyleValue archetype.
+ * @return The StyleValue Class.
+ * @memberof StyleValue
+ */
+OBJECTIVELYMVC_EXPORT Class *_StyleValue(void);
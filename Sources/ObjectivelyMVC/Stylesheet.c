@@ -22,10 +22,14 @@
  */
 
 #include <assert.h>
+#include <ctype.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <Objectively/Hash.h>
+#include <Objectively/MutableData.h>
 
+#include "CompiledData.h"
 #include "ObjectivelyMVC.h"
 
 #include "../Assets/stylesheet.css.h"
@@ -86,21 +90,294 @@ static bool isEqual(const Object *self, const Object *other) {
 
 #pragma mark - Stylesheet
 
-static Stylesheet *_defaultStylesheet;
+/**
+ * @return A Dictionary of the Selectors of `stylesheet`, keyed and grouped by rule.
+ */
+static Dictionary *selectorsByRule(const Stylesheet *stylesheet) {
+
+  Dictionary *selectors = $$(Dictionary, dictionaryWithCapacity, stylesheet->selectors->count);
+  assert(selectors);
+
+  for (size_t i = 0; i < stylesheet->styles->count; i++) {
+
+    const Style *style = stylesheet->styles->elements[i];
+    for (size_t j = 0; j < style->selectors->count; j++) {
+
+      Selector *selector = style->selectors->elements[j];
+
+      String *rule = $$(String, stringWithCharacters, selector->rule);
+      assert(rule);
+
+      Array *group = $(selectors, objectForKey, rule);
+      if (group == NULL) {
+        group = $$(Array, arrayWithCapacity, 1);
+        assert(group);
+
+        $(selectors, setObjectForKey, group, rule);
+        release(group);
+      }
+
+      $(group, addObject, selector);
+      release(rule);
+    }
+  }
+
+  return selectors;
+}
 
 /**
- * @fn Stylesheet *Stylesheet::defaultStylesheet(void)
+ * @return True if the Selectors in `a` and `b`, which share a rule, declare the same attributes.
+ */
+static bool isGroupEqual(const Array *a, const Array *b) {
+
+  if (a->count != b->count) {
+    return false;
+  }
+
+  for (size_t i = 0; i < a->count; i++) {
+
+    const Style *this = ((Selector *) a->elements[i])->style;
+    const Style *that = ((Selector *) b->elements[i])->style;
+
+    if (!$((Object *) this->attributes, isEqual, (Object *) that->attributes)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @fn Array *Stylesheet::changedSelectors(const Stylesheet *self, const Stylesheet *stylesheet)
  * @memberof Stylesheet
  */
-static Stylesheet *defaultStylesheet(void) {
-  static Once once;
+static Array *changedSelectors(const Stylesheet *self, const Stylesheet *stylesheet) {
 
-  do_once(&once, {
-    _defaultStylesheet = $$(Stylesheet, stylesheetWithCharacters, (char *) stylesheet_css);
-    assert(_defaultStylesheet);
-  });
+  assert(stylesheet);
 
-  return _defaultStylesheet;
+  Array *changed = $$(Array, arrayWithCapacity, 8);
+  assert(changed);
+
+  Dictionary *before = selectorsByRule(self);
+  Dictionary *after = selectorsByRule(stylesheet);
+
+  Array *rules = $(after, allKeys);
+  for (size_t i = 0; i < rules->count; i++) {
+
+    const String *rule = rules->elements[i];
+
+    const Array *a = $(before, objectForKey, rule);
+    const Array *b = $(after, objectForKey, rule);
+
+    if (a == NULL || !isGroupEqual(a, b)) {
+      $(changed, addObject, $(b, firstObject));
+    }
+  }
+
+  release(rules);
+
+  rules = $(before, allKeys);
+  for (size_t i = 0; i < rules->count; i++) {
+
+    const String *rule = rules->elements[i];
+
+    if ($(after, objectForKey, rule) == NULL) {
+      $(changed, addObject, $((Array *) $(before, objectForKey, rule), firstObject));
+    }
+  }
+
+  release(rules);
+
+  release(before);
+  release(after);
+
+  return changed;
+}
+
+/**
+ * @brief Appends the given Style, its Selectors, and its attributes to `data`.
+ */
+static void writeStyle(MutableData *data, const Style *style) {
+
+  MVC_WriteCompiledInteger(data, (uint32_t) style->selectors->count);
+  for (size_t i = 0; i < style->selectors->count; i++) {
+
+    const Selector *selector = style->selectors->elements[i];
+    MVC_WriteCompiledString(data, selector->rule);
+
+    MVC_WriteCompiledInteger(data, (uint32_t) selector->sequences->count);
+    for (size_t j = 0; j < selector->sequences->count; j++) {
+
+      const SelectorSequence *sequence = selector->sequences->elements[j];
+      MVC_WriteCompiledString(data, sequence->sequence);
+      MVC_WriteCompiledInteger(data, sequence->left);
+      MVC_WriteCompiledInteger(data, sequence->right);
+
+      MVC_WriteCompiledInteger(data, (uint32_t) sequence->simpleSelectors->count);
+      for (size_t k = 0; k < sequence->simpleSelectors->count; k++) {
+
+        const SimpleSelector *simpleSelector = sequence->simpleSelectors->elements[k];
+        MVC_WriteCompiledInteger(data, simpleSelector->type);
+        MVC_WriteCompiledString(data, simpleSelector->pattern);
+      }
+    }
+  }
+
+  Array *sortedKeys = MVC_CompiledKeys(style->attributes);
+
+  MVC_WriteCompiledInteger(data, (uint32_t) sortedKeys->count);
+  for (size_t i = 0; i < sortedKeys->count; i++) {
+
+    const String *key = sortedKeys->elements[i];
+    MVC_WriteCompiledString(data, key->chars);
+    MVC_WriteCompiledValue(data, NULL, $(style->attributes, objectForKey, key));
+  }
+
+  release(sortedKeys);
+}
+
+/**
+ * @fn Data *Stylesheet::compiledData(const Stylesheet *self)
+ * @memberof Stylesheet
+ */
+static Data *compiledData(const Stylesheet *self) {
+
+  MutableData *data = $$(MutableData, dataWithCapacity, 4096);
+  assert(data);
+
+  $(data, appendBytes, (const uint8_t *) STYLESHEET_COMPILED_MAGIC, 4);
+  MVC_WriteCompiledInteger(data, STYLESHEET_COMPILED_VERSION);
+
+  MVC_WriteCompiledInteger(data, (uint32_t) self->styles->count);
+  for (size_t i = 0; i < self->styles->count; i++) {
+    writeStyle(data, self->styles->elements[i]);
+  }
+
+  return (Data *) data;
+}
+
+/**
+ * @return True if `chars` is empty or contains only whitespace.
+ */
+static bool isBlank(const char *chars) {
+
+  while (isspace((unsigned char) *chars)) {
+    chars++;
+  }
+
+  return *chars == '\0';
+}
+
+/**
+ * @return The SelectorSequence at the read position, or `NULL` on error.
+ */
+static SelectorSequence *readSequence(CompiledReader *reader) {
+
+  const char *chars = MVC_ReadCompiledString(reader);
+  const SequenceCombinator left = MVC_ReadCompiledInteger(reader);
+  const SequenceCombinator right = MVC_ReadCompiledInteger(reader);
+
+  const uint32_t count = MVC_ReadCompiledCount(reader);
+  if (reader->error || count == 0 || isBlank(chars)) {
+    reader->error = true;
+    return NULL;
+  }
+
+  Array *simpleSelectors = $$(Array, arrayWithCapacity, count);
+  assert(simpleSelectors);
+
+  for (uint32_t i = 0; i < count; i++) {
+
+    const SimpleSelectorType type = MVC_ReadCompiledInteger(reader);
+    const char *pattern = MVC_ReadCompiledString(reader);
+
+    if (reader->error || type <= SimpleSelectorTypeNone || type > SimpleSelectorTypePseudo || isBlank(pattern)) {
+      reader->error = true;
+      break;
+    }
+
+    SimpleSelector *simpleSelector = $(alloc(SimpleSelector), initWithType, type, pattern);
+    assert(simpleSelector);
+
+    $(simpleSelectors, addObject, simpleSelector);
+    release(simpleSelector);
+  }
+
+  SelectorSequence *sequence = NULL;
+  if (!reader->error) {
+    sequence = $(alloc(SelectorSequence), initWithSimpleSelectors, chars, simpleSelectors);
+    assert(sequence);
+
+    sequence->left = left;
+    sequence->right = right;
+  }
+
+  release(simpleSelectors);
+  return sequence;
+}
+
+/**
+ * @return The Style at the read position, or `NULL` on error.
+ */
+static Style *readStyle(CompiledReader *reader) {
+
+  Style *style = $(alloc(Style), initWithRules, NULL);
+  assert(style);
+
+  const uint32_t numSelectors = MVC_ReadCompiledCount(reader);
+  for (uint32_t i = 0; i < numSelectors && !reader->error; i++) {
+
+    const char *rule = MVC_ReadCompiledString(reader);
+
+    const uint32_t numSequences = MVC_ReadCompiledCount(reader);
+    if (reader->error || numSequences == 0) {
+      reader->error = true;
+      break;
+    }
+
+    Array *sequences = $$(Array, arrayWithCapacity, numSequences);
+    assert(sequences);
+
+    for (uint32_t j = 0; j < numSequences && !reader->error; j++) {
+      SelectorSequence *sequence = readSequence(reader);
+      if (sequence) {
+        $(sequences, addObject, sequence);
+        release(sequence);
+      }
+    }
+
+    if (!reader->error) {
+      Selector *selector = $(alloc(Selector), initWithSequences, rule, sequences);
+      assert(selector);
+
+      selector->style = style;
+
+      $(style, addSelector, selector);
+      release(selector);
+    }
+
+    release(sequences);
+  }
+
+  const uint32_t numAttributes = MVC_ReadCompiledCount(reader);
+  for (uint32_t i = 0; i < numAttributes && !reader->error; i++) {
+
+    const char *attr = MVC_ReadCompiledString(reader);
+
+    ident value = MVC_ReadCompiledValue(reader);
+    if (value) {
+      if (!reader->error) {
+        $(style, addAttribute, attr, value);
+      }
+      release(value);
+    }
+  }
+
+  if (reader->error) {
+    style = release(style);
+  }
+
+  return style;
 }
 
 static ident selectorsReducer(const ident obj, ident accumulator, ident data) {
@@ -118,15 +395,14 @@ static Order selectorsComparator(const ident a, const ident b) {
 }
 
 /**
- * @fn Stylesheet *Stylesheet::initWithCharacters(Stylesheet *self, const char *chars)
- * @memberof Stylesheet
+ * @brief Initializes this Stylesheet with the given Styles.
  */
-static Stylesheet *initWithCharacters(Stylesheet *self, const char *chars) {
+static Stylesheet *initWithStyles(Stylesheet *self, Array *styles) {
 
   self = (Stylesheet *) super(Object, self, init);
   if (self) {
 
-    self->styles = $$(Style, parse, chars);
+    self->styles = retain(styles);
     assert(self->styles);
 
     Array *selectors = $$(Array, array);
@@ -143,6 +419,111 @@ static Stylesheet *initWithCharacters(Stylesheet *self, const char *chars) {
   return self;
 }
 
+/**
+ * @fn Stylesheet *Stylesheet::initWithCharacters(Stylesheet *self, const char *chars)
+ * @memberof Stylesheet
+ */
+static Stylesheet *initWithCharacters(Stylesheet *self, const char *chars) {
+
+  Array *styles = $$(Style, parse, chars);
+  assert(styles);
+
+  self = initWithStyles(self, styles);
+
+  release(styles);
+  return self;
+}
+
+/**
+ * @return True if `data` begins with the compiled Stylesheet magic.
+ */
+static bool isCompiledData(const Data *data) {
+  return data->length >= 4 && memcmp(data->bytes, STYLESHEET_COMPILED_MAGIC, 4) == 0;
+}
+
+/**
+ * @fn Stylesheet *Stylesheet::initWithCompiledData(Stylesheet *self, const Data *data)
+ * @memberof Stylesheet
+ */
+static Stylesheet *initWithCompiledData(Stylesheet *self, const Data *data) {
+
+  assert(data);
+
+  CompiledReader reader = {
+    .bytes = data->bytes,
+    .end = data->bytes + data->length
+  };
+
+  if (!isCompiledData(data)) {
+    MVC_LogError("Not a compiled Stylesheet\n");
+    return release(self);
+  }
+
+  reader.bytes += 4;
+
+  const uint32_t version = MVC_ReadCompiledInteger(&reader);
+  if (version != STYLESHEET_COMPILED_VERSION) {
+    MVC_LogError("Unsupported compiled Stylesheet version %u\n", version);
+    return release(self);
+  }
+
+  const uint32_t count = MVC_ReadCompiledCount(&reader);
+
+  Array *styles = $$(Array, arrayWithCapacity, count);
+  assert(styles);
+
+  for (uint32_t i = 0; i < count && !reader.error; i++) {
+    Style *style = readStyle(&reader);
+    if (style) {
+      $(styles, addObject, style);
+      release(style);
+    }
+  }
+
+  if (reader.error || reader.bytes != reader.end) {
+    MVC_LogError("Malformed compiled Stylesheet\n");
+    self = release(self);
+  } else {
+    self = initWithStyles(self, styles);
+  }
+
+  release(styles);
+  return self;
+}
+
+static Stylesheet *_defaultStylesheet;
+
+/**
+ * @fn Stylesheet *Stylesheet::defaultStylesheet(void)
+ * @memberof Stylesheet
+ */
+static Stylesheet *defaultStylesheet(void) {
+  static Once once;
+
+  do_once(&once, {
+    int compiledHash;
+    Data *data = MVC_CompiledDefaultStylesheet(&compiledHash);
+    if (data) {
+      const char *css = (char *) stylesheet_css;
+      const int sourceHash = HashForBytes(HASH_SEED, (uint8_t *) css, (Range) { .location = 0, .length = strlen(css) });
+
+      if (sourceHash == compiledHash) {
+        _defaultStylesheet = $$(Stylesheet, stylesheetWithCompiledData, data);
+      } else {
+        MVC_LogWarn("stylesheet.cssb.h is stale, parsing stylesheet.css\n");
+      }
+
+      release(data);
+    }
+    if (_defaultStylesheet == NULL) {
+      _defaultStylesheet = $$(Stylesheet, stylesheetWithCharacters, (char *) stylesheet_css);
+    }
+    assert(_defaultStylesheet);
+  });
+
+  return _defaultStylesheet;
+}
+
 /**
  * @fn Stylesheet *Stylesheet::initWithData(Stylesheet *self, const Data *data)
  * @memberof Stylesheet
@@ -151,6 +532,10 @@ static Stylesheet *initWithData(Stylesheet *self, const Data *data) {
 
   assert(data);
 
+  if (isCompiledData(data)) {
+    return $(self, initWithCompiledData, data);
+  }
+
   String *string = $$(String, stringWithData, data, STRING_ENCODING_UTF8);
   assert(string);
 
@@ -207,6 +592,14 @@ static Stylesheet *stylesheetWithCharacters(const char *chars) {
   return $(alloc(Stylesheet), initWithCharacters, chars);
 }
 
+/**
+ * @fn Stylesheet *Stylesheet::stylesheetWithCompiledData(const Data *data)
+ * @memberof Stylesheet
+ */
+static Stylesheet *stylesheetWithCompiledData(const Data *data) {
+  return $(alloc(Stylesheet), initWithCompiledData, data);
+}
+
 /**
  * @fn Stylesheet *Stylesheet::stylesheetWithCharacters(const Data *data)
  * @memberof Stylesheet
@@ -250,13 +643,17 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->hash = hash;
   ((ObjectInterface *) clazz->interface)->isEqual = isEqual;
 
+  ((StylesheetInterface *) clazz->interface)->changedSelectors = changedSelectors;
+  ((StylesheetInterface *) clazz->interface)->compiledData = compiledData;
   ((StylesheetInterface *) clazz->interface)->defaultStylesheet = defaultStylesheet;
   ((StylesheetInterface *) clazz->interface)->initWithCharacters = initWithCharacters;
+  ((StylesheetInterface *) clazz->interface)->initWithCompiledData = initWithCompiledData;
   ((StylesheetInterface *) clazz->interface)->initWithData = initWithData;
   ((StylesheetInterface *) clazz->interface)->initWithResource = initWithResource;
   ((StylesheetInterface *) clazz->interface)->initWithResourceName = initWithResourceName;
   ((StylesheetInterface *) clazz->interface)->initWithString = initWithString;
   ((StylesheetInterface *) clazz->interface)->stylesheetWithCharacters = stylesheetWithCharacters;
+  ((StylesheetInterface *) clazz->interface)->stylesheetWithCompiledData = stylesheetWithCompiledData;
   ((StylesheetInterface *) clazz->interface)->stylesheetWithData = stylesheetWithData;
   ((StylesheetInterface *) clazz->interface)->stylesheetWithResource = stylesheetWithResource;
   ((StylesheetInterface *) clazz->interface)->stylesheetWithResourceName = stylesheetWithResourceName;
@@ -34,6 +34,17 @@
  * @brief The Stylesheet type.
  */
 
+/**
+ * @brief The leading bytes of compiled Stylesheets.
+ */
+#define STYLESHEET_COMPILED_MAGIC "MVCS"
+
+/**
+ * @brief The version of the compiled Stylesheet format.
+ * @remarks Increment this whenever the format changes, so that stale blobs are rejected.
+ */
+#define STYLESHEET_COMPILED_VERSION 1
+
 typedef struct Stylesheet Stylesheet;
 typedef struct StylesheetInterface StylesheetInterface;
 
@@ -75,6 +86,27 @@ struct StylesheetInterface {
    */
   ObjectInterface objectInterface;
 
+  /**
+   * @fn Array *Stylesheet::changedSelectors(const Stylesheet *self, const Stylesheet *stylesheet)
+   * @brief Compares this Stylesheet to a revision of it, such as one reloaded from disk.
+   * @param self The Stylesheet.
+   * @param stylesheet The revised Stylesheet.
+   * @return The Selectors of either Stylesheet whose rules were added, removed, or whose
+   * attributes changed. Views matched by none of these Selectors are unaffected by the revision.
+   * @memberof Stylesheet
+   */
+  Array *(*changedSelectors)(const Stylesheet *self, const Stylesheet *stylesheet);
+
+  /**
+   * @fn Data *Stylesheet::compiledData(const Stylesheet *self)
+   * @brief Compiles this Stylesheet to a versioned binary representation.
+   * @param self The Stylesheet.
+   * @return The compiled Stylesheet Data, which may be loaded without parsing CSS.
+   * @see Stylesheet::initWithCompiledData(Stylesheet *, const Data *)
+   * @memberof Stylesheet
+   */
+  Data *(*compiledData)(const Stylesheet *self);
+
   /**
    * @static
    * @fn Stylesheet *Stylesheet::defaultStylesheet(void)
@@ -94,11 +126,21 @@ struct StylesheetInterface {
    */
   Stylesheet *(*initWithCharacters)(Stylesheet *self, const char *chars);
 
+  /**
+   * @fn Stylesheet *Stylesheet::initWithCompiledData(Stylesheet *self, const Data *data)
+   * @brief Initializes this Stylesheet with compiled Stylesheet Data.
+   * @param self The Stylesheet.
+   * @param data The Data, as returned by Stylesheet::compiledData.
+   * @return The initialized Stylesheet, or `NULL` if `data` is malformed or of another version.
+   * @memberof Stylesheet
+   */
+  Stylesheet *(*initWithCompiledData)(Stylesheet *self, const Data *data);
+
   /**
    * @fn Stylesheet *Stylesheet::initWithData(Stylesheet *self, const Data *data)
    * @brief Initializes this Stylesheet with the CSS definitions in `data`.
    * @param self The Stylesheet.
-   * @param data The Data containing CSS definitions.
+   * @param data The Data containing CSS definitions, or a compiled Stylesheet.
    * @return The initialized Stylesheet, or `NULL` on error.
    * @memberof Stylesheet
    */
@@ -144,6 +186,16 @@ struct StylesheetInterface {
    */
   Stylesheet *(*stylesheetWithCharacters)(const char *chars);
 
+  /**
+   * @static
+   * @fn Stylesheet *Stylesheet::stylesheetWithCompiledData(const Data *data)
+   * @brief Instantiates a new Stylesheet with compiled Stylesheet Data.
+   * @param data The Data, as returned by Stylesheet::compiledData.
+   * @return The new Stylesheet, or `NULL` on error.
+   * @memberof Stylesheet
+   */
+  Stylesheet *(*stylesheetWithCompiledData)(const Data *data);
+
   /**
    * @static
    * @fn Stylesheet *Stylesheet::stylesheetWithCharacters(const Data *data)
@@ -41,6 +41,32 @@ static void dealloc(Object *self) {
   super(Object, self, dealloc);
 }
 
+#pragma mark - View
+
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  TableCellView *this = (TableCellView *) self;
+  const TableCellView *that = (TableCellView *) prototype;
+
+  Text *text = (Text *) $(self, counterpart, prototype, (View *) that->text);
+  if (text && text != this->text) {
+    release(this->text);
+    this->text = retain(text);
+  }
+}
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+  return (View *) $((TableCellView *) self, initWithFrame, NULL);
+}
+
 #pragma mark - TableCellView
 
 /**
@@ -69,6 +95,9 @@ static void initialize(Class *clazz) {
 
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->init = init;
+
   ((TableCellViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
 }
 
@@ -41,7 +41,8 @@ static void dealloc(Object *self) {
   TableColumn *this = (TableColumn *) self;
 
   release(this->headerCell);
-  
+  release(this->prototype);
+
   free(this->identifier);
 
   super(Object, self, dealloc);
@@ -72,6 +73,18 @@ static TableColumn *initWithIdentifier(TableColumn *self, const char *identifier
   return self;
 }
 
+/**
+ * @fn void TableColumn::setPrototype(TableColumn *self, TableCellView *prototype)
+ * @memberof TableColumn
+ */
+static void setPrototype(TableColumn *self, TableCellView *prototype) {
+
+  if (prototype != self->prototype) {
+    release(self->prototype);
+    self->prototype = prototype ? retain(prototype) : NULL;
+  }
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -82,6 +95,7 @@ static void initialize(Class *clazz) {
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
   ((TableColumnInterface *) clazz->interface)->initWithIdentifier = initWithIdentifier;
+  ((TableColumnInterface *) clazz->interface)->setPrototype = setPrototype;
 }
 
 /**
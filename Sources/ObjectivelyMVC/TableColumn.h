@@ -34,9 +34,49 @@
 
 #define DEFAULT_TABLE_COLUMN_WIDTH 100
 
+typedef struct TableCellRenderer TableCellRenderer;
+
+typedef struct TableRowView TableRowView;
+
 typedef struct TableColumn TableColumn;
 typedef struct TableColumnInterface TableColumnInterface;
 
+/**
+ * @brief The TableCellRenderer protocol.
+ * @details A TableColumn with a TableCellRenderer has no TableCellViews. Its cells are drawn by
+ * their TableRowView, directly through the Renderer, from the values reported by the
+ * TableViewDataSource. This avoids the View, Style and Texture of each cell, and suits large,
+ * read-only tables.
+ */
+struct TableCellRenderer {
+
+  /**
+   * @brief The renderer self-reference.
+   */
+  ident self;
+
+  /**
+   * @brief Draws a cell.
+   * @param column The TableColumn.
+   * @param row The TableRowView.
+   * @param renderer The Renderer.
+   * @param frame The frame of the cell, in window space.
+   * @param value The value of the cell.
+   * @see TableViewDataSource::valueForColumnAndRow
+   */
+  void (*drawCell)(const TableColumn *column, const TableRowView *row, Renderer *renderer, const SDL_Rect *frame, ident value);
+
+  /**
+   * @brief Measures a cell.
+   * @param column The TableColumn.
+   * @param value The value of the cell.
+   * @return The natural size of the cell.
+   * @remarks This function is optional. If not set, cells are as tall as the TableView's
+   * `rowHeight`.
+   */
+  SDL_Size (*measureCell)(const TableColumn *column, ident value);
+};
+
 /**
  * @brief Columns provide alignment, spacing and sorting hints for TableView instances.
  * @extends Object
@@ -55,6 +95,21 @@ struct TableColumn {
    */
   TableColumnInterface *interface;
 
+  /**
+   * @brief An optional Comparator for the values of this column.
+   * @remarks If set, TableViews sort their rows by this column's values when it is the sort
+   * column.
+   * @see TableViewDataSource::valueForColumnAndRow
+   */
+  Comparator comparator;
+
+  /**
+   * @brief The optional TableCellRenderer, which draws this column's cells without TableCellViews.
+   * @remarks When `cellRenderer.drawCell` is set, TableViews do not request cells for this column
+   * from their delegate.
+   */
+  TableCellRenderer cellRenderer;
+
   /**
    * @brief The header cell.
    */
@@ -69,6 +124,19 @@ struct TableColumn {
    * @brief The sort order.
    */
   Order order;
+
+  /**
+   * @brief An optional, fully styled cell cloned for each row of this column.
+   * @see TableView::cloneCellPrototype(const TableView *, const TableColumn *)
+   */
+  TableCellView *prototype;
+
+  /**
+   * @brief If true, this column's values are Objects, which TableViews retain for as long as they
+   * hold them.
+   * @see TableViewDataSource::valueForColumnAndRow
+   */
+  bool retainsValues;
 };
 
 /**
@@ -90,6 +158,15 @@ struct TableColumnInterface {
    * @memberof TableColumn
    */
   TableColumn *(*initWithIdentifier)(TableColumn *self, const char *identifier);
+
+  /**
+   * @fn void TableColumn::setPrototype(TableColumn *self, TableCellView *prototype)
+   * @brief Registers the prototype cell for this column.
+   * @param self The TableColumn.
+   * @param prototype The prototype cell, or `NULL`.
+   * @memberof TableColumn
+   */
+  void (*setPrototype)(TableColumn *self, TableCellView *prototype);
 };
 
 /**
@@ -22,6 +22,7 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 
 #include "TableRowView.h"
 #include "TableView.h"
@@ -38,12 +39,96 @@ static void dealloc(Object *self) {
   TableRowView *this = (TableRowView *) self;
 
   release(this->cells);
+  release(this->retainedValues);
+
+  free(this->values);
 
   super(Object, self, dealloc);
 }
 
 #pragma mark - View
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  TableRowView *this = (TableRowView *) self;
+  const TableRowView *that = (TableRowView *) prototype;
+
+  $(this->cells, removeAllObjects);
+
+  const Array *cells = (Array *) that->cells;
+  for (size_t i = 0; i < cells->count; i++) {
+
+    View *cell = $(self, counterpart, prototype, cells->elements[i]);
+    if (cell) {
+      $(this->cells, addObject, cell);
+    }
+  }
+
+  this->isSelected = that->isSelected;
+  this->tableView = that->tableView;
+}
+
+/**
+ * @return The frame of the cell for the given column, relative to the row's padding box.
+ * @remarks Cells are aligned with the TableView's header cells.
+ */
+static SDL_Rect cellFrame(const TableRowView *self, const TableColumn *column) {
+
+  const View *view = (View *) self;
+  const View *headerCell = (View *) column->headerCell;
+
+  return (SDL_Rect) {
+    .x = headerCell->frame.x,
+    .y = 0,
+    .w = headerCell->frame.w,
+    .h = view->frame.h - view->padding.top - view->padding.bottom
+  };
+}
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+  return (View *) $((TableRowView *) self, initWithTableView, NULL);
+}
+
+/**
+ * @see View::layoutSubviews(View *)
+ */
+static void layoutSubviews(View *self) {
+
+  super(View, self, layoutSubviews);
+
+  TableRowView *this = (TableRowView *) self;
+
+  if (this->values) {
+
+    const Array *columns = (Array *) this->tableView->columns;
+    const Array *cells = (Array *) this->cells;
+
+    for (size_t i = 0, j = 0; i < columns->count && j < cells->count; i++) {
+
+      const TableColumn *column = columns->elements[i];
+      if (column->cellRenderer.drawCell) {
+        continue;
+      }
+
+      View *cell = cells->elements[j++];
+      const SDL_Rect frame = cellFrame(this, column);
+
+      cell->frame.x = frame.x;
+
+      $(cell, resize, &MakeSize(frame.w, cell->frame.h));
+      $(cell, layoutIfNeeded);
+    }
+  }
+}
+
 /**
  * @see View::matchesSelector(const View *, const SimpleSelector *)
  */
@@ -52,7 +137,7 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
   TableRowView *this = (TableRowView *) self;
 
   if (simpleSelector->type == SimpleSelectorTypePseudo) {
-    if (strcmp("selected", simpleSelector->pattern) == 0) {
+    if (simpleSelector->pseudoClass == PseudoClassSelected) {
       return this->isSelected;
     }
   }
@@ -60,6 +145,69 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
   return super(View, self, matchesSelector, simpleSelector);
 }
 
+/**
+ * @see View::render(View *, Renderer *)
+ */
+static void render(View *self, Renderer *renderer) {
+
+  super(View, self, render, renderer);
+
+  TableRowView *this = (TableRowView *) self;
+
+  if (this->values) {
+
+    const SDL_Rect frame = $(self, renderFrame);
+
+    const Array *columns = (Array *) this->tableView->columns;
+    for (size_t i = 0; i < columns->count && i < this->numValues; i++) {
+
+      const TableColumn *column = columns->elements[i];
+      if (column->cellRenderer.drawCell) {
+
+        SDL_Rect cell = cellFrame(this, column);
+
+        cell.x += frame.x + self->padding.left;
+        cell.y += frame.y + self->padding.top;
+
+        column->cellRenderer.drawCell(column, this, renderer, &cell, this->values[i]);
+      }
+    }
+  }
+}
+
+/**
+ * @see View::sizeThatFits(const View *)
+ */
+static SDL_Size sizeThatFits(const View *self) {
+
+  SDL_Size size = super(View, self, sizeThatFits);
+
+  const TableRowView *this = (TableRowView *) self;
+
+  if (this->values) {
+
+    const Array *columns = (Array *) this->tableView->columns;
+    for (size_t i = 0; i < columns->count && i < this->numValues; i++) {
+
+      const TableColumn *column = columns->elements[i];
+      if (column->cellRenderer.drawCell) {
+
+        SDL_Size cellSize = MakeSize(0, this->tableView->rowHeight);
+        if (column->cellRenderer.measureCell) {
+          cellSize = column->cellRenderer.measureCell(column, this->values[i]);
+        }
+
+        const View *headerCell = (View *) column->headerCell;
+
+        size.w = max(size.w, headerCell->frame.x + max(cellSize.w, headerCell->frame.w) + self->padding.left + self->padding.right);
+        size.h = max(size.h, cellSize.h + self->padding.top + self->padding.bottom);
+      }
+    }
+  }
+
+  return size;
+}
+
 #pragma mark - TableRowView
 
 /**
@@ -84,13 +232,10 @@ static TableRowView *initWithTableView(TableRowView *self, TableView *tableView)
   self = (TableRowView *) super(StackView, self, initWithFrame, NULL);
   if (self) {
 
-    const Array *columns = (Array *) tableView->columns;
-    
-    self->cells = $$(Array, arrayWithCapacity, columns->count);
+    self->cells = $$(Array, arrayWithCapacity, tableView ? ((Array *) tableView->columns)->count : 0);
     assert(self->cells);
 
     self->tableView = tableView;
-    assert(self->tableView);
   }
 
   return self;
@@ -133,7 +278,7 @@ static void setSelected(TableRowView *self, bool isSelected) {
 
   if (isSelected != self->isSelected) {
     self->isSelected = isSelected;
-    $((View *) self, invalidateStyle);
+    $((View *) self, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, "selected");
   }
 }
 
@@ -146,7 +291,12 @@ static void initialize(Class *clazz) {
 
   ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
 
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->init = init;
+  ((ViewInterface *) clazz->interface)->layoutSubviews = layoutSubviews;
   ((ViewInterface *) clazz->interface)->matchesSelector = matchesSelector;
+  ((ViewInterface *) clazz->interface)->render = render;
+  ((ViewInterface *) clazz->interface)->sizeThatFits = sizeThatFits;
 
   ((TableRowViewInterface *) clazz->interface)->addCell = addCell;
   ((TableRowViewInterface *) clazz->interface)->initWithTableView = initWithTableView;
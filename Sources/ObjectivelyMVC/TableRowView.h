@@ -64,10 +64,28 @@ struct TableRowView {
    */
   bool isSelected;
 
+  /**
+   * @brief The number of `values`.
+   */
+  size_t numValues;
+
+  /**
+   * @brief The `values` of columns that retain their values.
+   * @see TableColumn::retainsValues
+   * @private
+   */
+  Array *retainedValues;
+
   /**
    * @brief The table.
    */
   TableView *tableView;
+
+  /**
+   * @brief The values of the cells drawn by TableCellRenderers, by column index, or `NULL` if
+   * no column has a TableCellRenderer.
+   */
+  ident *values;
 };
 
 /**
@@ -93,7 +111,7 @@ struct TableRowViewInterface {
    * @fn TableRowView *TableRowView::initWithTableView(TableRowView *self, TableView *tableView)
    * @brief Initializes this TableRowView with the given table.
    * @param self The TableRowView.
-   * @param tableView The table.
+   * @param tableView The table, or `NULL` for a row that will be awoken with a prototype.
    * @return The initialized TableRowView, or `NULL` on error.
    * @memberof TableRowView
    */
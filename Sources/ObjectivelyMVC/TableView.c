@@ -22,70 +22,987 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <Objectively/String.h>
 
 #include "TableView.h"
+#include "Theme.h"
 
 #define _Class _TableView
 
+/**
+ * @brief The number of frames of scrolling, at the current speed, for which rows are prefetched.
+ */
+#define PREFETCH_FRAMES 8
+
 #pragma mark - Object
 
 /**
- * @see Object::dealloc(Object *)
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  TableView *this = (TableView *) self;
+
+  memset(&this->delegate, 0, sizeof(this->delegate));
+
+  free(this->rowOffsets);
+  free(this->rowPermutation);
+  free(this->sortKeys);
+
+  release(this->columns);
+  release(this->contentView);
+  release(this->headerView);
+  release(this->retainedSortKeys);
+  release(this->reusableCells);
+  release(this->reusableRows);
+  release(this->rows);
+  release(this->scrollView);
+  release(this->selectedRows);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - View
+
+/**
+ * @brief ArrayEnumerator for awaking TableColumns.
+ */
+static void awakeWithDictionary_columns(const Array *array, ident obj, ident data) {
+
+  const String *identifier = $((Dictionary *) obj, objectForKeyPath, "identifier");
+  assert(identifier);
+
+  TableColumn *column = $(alloc(TableColumn), initWithIdentifier, identifier->chars);
+  assert(column);
+
+  $((TableView *) data, addColumn, column);
+
+  release(column);
+}
+
+/**
+ * @see View::awakeWithDictionary(View *, const Dictionary *)
+ */
+static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
+
+  super(View, self, awakeWithDictionary, dictionary);
+
+  TableView *this = (TableView *) self;
+
+  const Array *columns = $(dictionary, objectForKeyPath, "columns");
+  if (columns) {
+    $(columns, enumerate, awakeWithDictionary_columns, self);
+  }
+
+  const Inlet inlets[] = MakeInlets(
+    MakeInlet("rowHeight", InletTypeInteger, &this->rowHeight, NULL),
+    MakeInlet("virtualized", InletTypeBool, &this->virtualized, NULL)
+  );
+
+  $(self, bind, inlets, dictionary);
+}
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+  return (View *) $((TableView *) self, initWithFrame, NULL);
+}
+
+/**
+ * @return The offset of the specified row within the content View.
+ */
+static int offsetOfRow(const TableView *self, size_t row) {
+
+  if (self->rowOffsets) {
+    return self->rowOffsets[row];
+  }
+
+  return (int) row * self->rowHeight;
+}
+
+/**
+ * @return The height of the specified row.
+ */
+static int heightOfRow(const TableView *self, size_t row) {
+  return offsetOfRow(self, row + 1) - offsetOfRow(self, row);
+}
+
+/**
+ * @return The row at the specified offset within the content View, clamped to the valid rows.
+ */
+static size_t rowAtOffset(const TableView *self, int offset) {
+
+  if (self->numberOfRows == 0 || offset <= 0) {
+    return 0;
+  }
+
+  size_t row;
+
+  if (self->rowOffsets) {
+    size_t low = 0, high = self->numberOfRows;
+    while (high - low > 1) {
+      const size_t mid = low + (high - low) / 2;
+      if (self->rowOffsets[mid] <= offset) {
+        low = mid;
+      } else {
+        high = mid;
+      }
+    }
+    row = low;
+  } else if (self->rowHeight > 0) {
+    row = offset / self->rowHeight;
+  } else {
+    row = 0;
+  }
+
+  return min(row, self->numberOfRows - 1);
+}
+
+/**
+ * @return The TableRowView for the specified row, or `NULL` if it is not instantiated.
+ */
+static TableRowView *visibleRow(const TableView *self, size_t row) {
+
+  const Array *rows = (Array *) self->rows;
+  if (row >= self->firstRow && row < self->firstRow + rows->count) {
+    return rows->elements[row - self->firstRow];
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Removes the cells from the given row, and makes them available for reuse, retaining at
+ * most `capacity` cells per column.
+ */
+static void enqueueReusableCells(TableView *self, TableRowView *row, size_t capacity) {
+
+  const Array *columns = (Array *) self->columns;
+  const Array *cells = (Array *) row->cells;
+
+  for (size_t i = 0, j = 0; i < columns->count && j < cells->count; i++) {
+
+    const TableColumn *column = columns->elements[i];
+    if (column->cellRenderer.drawCell) {
+      continue;
+    }
+
+    TableCellView *cell = cells->elements[j++];
+
+    Array *reusableCells = $(self->reusableCells, objectForKey, (ident) column);
+    if (reusableCells == NULL) {
+      reusableCells = $$(Array, array);
+      $(self->reusableCells, setObjectForKey, reusableCells, (ident) column);
+      release(reusableCells);
+    }
+
+    if (reusableCells->count < capacity) {
+      $(reusableCells, addObject, cell);
+    }
+  }
+
+  $(row, removeAllCells);
+
+  if (row->retainedValues) {
+    $(row->retainedValues, removeAllObjects);
+  }
+}
+
+/**
+ * @brief Removes the given row from the content View, and makes it and its cells available for
+ * reuse, retaining at most `capacity` rows and cells per column.
+ */
+static void enqueueReusableRow(TableView *self, TableRowView *row, size_t capacity) {
+
+  enqueueReusableCells(self, row, capacity);
+
+  $((View *) row, removeFromSuperview);
+
+  if (self->reusableRows->count < capacity) {
+    $(self->reusableRows, addObject, row);
+  }
+}
+
+/**
+ * @brief Populates the given row, which must be empty, with the cells for the specified row.
+ */
+static void populateRow(TableView *self, TableRowView *row, size_t index) {
+
+  const Array *columns = (Array *) self->columns;
+
+  free(row->values);
+  row->values = NULL;
+  row->numValues = 0;
+
+  for (size_t i = 0; i < columns->count; i++) {
+    const TableColumn *column = columns->elements[i];
+
+    if (column->cellRenderer.drawCell) {
+      assert(self->dataSource.valueForColumnAndRow);
+
+      if (row->values == NULL) {
+        row->values = calloc(columns->count, sizeof(ident));
+        assert(row->values);
+
+        row->numValues = columns->count;
+      }
+
+      const ident value = self->dataSource.valueForColumnAndRow(self, column, $(self, sourceRow, index));
+      if (value && column->retainsValues) {
+        if (row->retainedValues == NULL) {
+          row->retainedValues = $$(Array, array);
+          assert(row->retainedValues);
+        }
+
+        $(row->retainedValues, addObject, value);
+      }
+
+      row->values[i] = value;
+      continue;
+    }
+
+    assert(self->delegate.cellForColumnAndRow);
+
+    TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, $(self, sourceRow, index));
+    assert(cell);
+
+    free(cell->view.identifier);
+    cell->view.identifier = strdup(column->identifier);
+
+    $(row, addCell, cell);
+    release(cell);
+  }
+
+  if (self->virtualized) {
+    View *view = (View *) row;
+    view->minSize.h = view->maxSize.h = heightOfRow(self, index);
+  }
+
+  $(row, setSelected, $(self, isRowSelected, index));
+}
+
+/**
+ * @brief Repopulates the given row with the cells for the specified row.
+ */
+static void repopulateRow(TableView *self, TableRowView *row, size_t index) {
+
+  enqueueReusableCells(self, row, 1);
+  populateRow(self, row, index);
+
+  View *contentView = (View *) self->contentView;
+  if (contentView->window) {
+    $((View *) row, applyThemeIfNeeded, $$(Theme, theme, contentView->window));
+  }
+}
+
+/**
+ * @return A new or reused TableRowView, populated with the cells for the specified row.
+ */
+static TableRowView *createRow(TableView *self, size_t index) {
+
+  TableRowView *row = $((Array *) self->reusableRows, lastObject);
+  if (row) {
+    retain(row);
+    $(self->reusableRows, removeObjectAtIndex, self->reusableRows->count - 1);
+  } else {
+    row = $(alloc(TableRowView), initWithTableView, self);
+    assert(row);
+  }
+
+  populateRow(self, row, index);
+
+  return row;
+}
+
+/**
+ * @brief Updates the cached row offsets of a virtualized TableView with variable row heights.
+ */
+static void updateRowOffsets(TableView *self) {
+
+  free(self->rowOffsets);
+  self->rowOffsets = NULL;
+
+  if (self->virtualized && self->delegate.heightForRow) {
+    self->rowOffsets = malloc((self->numberOfRows + 1) * sizeof(int));
+    assert(self->rowOffsets);
+
+    self->rowOffsets[0] = 0;
+    for (size_t i = 0; i < self->numberOfRows; i++) {
+      self->rowOffsets[i + 1] = self->rowOffsets[i] + self->delegate.heightForRow(self, $(self, sourceRow, i));
+    }
+  }
+}
+
+/**
+ * @brief Discards the prefetched rows, without cancelling them, after the rows have changed.
+ */
+static void resetPrefetching(TableView *self) {
+
+  self->prefetchedRows = (Range) { .location = 0, .length = 0 };
+  self->prefetchOffset = -self->scrollView->contentOffset.y;
+}
+
+/**
+ * @brief Updates the instantiated rows after rows were inserted, deleted or moved.
+ * @param self The TableView.
+ * @param indexes The new index of each instantiated row, or `-1` for rows that are to be
+ * recycled. Retained rows must remain in ascending order.
+ * @remarks Retained rows keep their cells. Rows are created to fill any gaps, and, if this
+ * TableView is not virtualized, to instantiate all rows.
+ */
+static void updateRows(TableView *self, const ssize_t *indexes) {
+
+  resetPrefetching(self);
+
+  const Array *rows = (Array *) self->rows;
+
+  size_t first = SIZE_MAX, last = 0;
+  for (size_t i = 0; i < rows->count; i++) {
+    if (indexes[i] == -1) {
+      enqueueReusableRow(self, rows->elements[i], rows->count);
+    } else {
+      first = min(first, (size_t) indexes[i]);
+      last = indexes[i] + 1;
+    }
+  }
+
+  if (self->virtualized == false) {
+    first = 0;
+    last = self->numberOfRows;
+  } else if (first == SIZE_MAX) {
+    first = last = 0;
+  } else {
+    first &= ~((size_t) 1);
+  }
+
+  Array *updated = $$(Array, arrayWithCapacity, last - first);
+  assert(updated);
+
+  View *contentView = (View *) self->contentView;
+  Theme *theme = contentView->window ? $$(Theme, theme, contentView->window) : NULL;
+
+  View *previous = NULL;
+  size_t j = 0;
+
+  for (size_t i = first; i < last; i++) {
+
+    while (j < rows->count && indexes[j] == -1) {
+      j++;
+    }
+
+    TableRowView *row;
+    if (j < rows->count && indexes[j] == (ssize_t) i) {
+      row = retain(rows->elements[j++]);
+    } else {
+      row = createRow(self, i);
+
+      if (previous) {
+        $(contentView, addSubviewRelativeTo, (View *) row, previous, ViewPositionAfter);
+      } else {
+        View *next = $((Array *) contentView->subviews, firstObject);
+        $(contentView, addSubviewRelativeTo, (View *) row, next, ViewPositionBefore);
+      }
+
+      if (theme) {
+        $((View *) row, applyThemeIfNeeded, theme);
+      }
+    }
+
+    $(updated, addObject, row);
+    release(row);
+
+    previous = (View *) row;
+  }
+
+  release(self->rows);
+  self->rows = updated;
+  self->firstRow = first;
+
+  if (self->virtualized == false) {
+    $(self->reusableCells, removeAllObjects);
+    $(self->reusableRows, removeAllObjects);
+  }
+}
+
+/**
+ * @return The index of `index` after the rows at `inserted` were inserted.
+ */
+static size_t indexAfterInsertion(const IndexSet *inserted, size_t index) {
+
+  size_t low = 0, high = inserted->count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (inserted->indexes[mid] - mid <= index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  return index + low;
+}
+
+/**
+ * @return The index of `index` after the rows at `deleted` were deleted, or `-1` if it was deleted.
+ */
+static ssize_t indexAfterDeletion(const IndexSet *deleted, size_t index) {
+
+  size_t low = 0, high = deleted->count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    if (deleted->indexes[mid] < index) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  if (low < deleted->count && deleted->indexes[low] == index) {
+    return -1;
+  }
+
+  return index - low;
+}
+
+/**
+ * @brief qsort comparator for row numbers.
+ */
+static int compareRows(const void *a, const void *b) {
+
+  const size_t i = *(const size_t *) a;
+  const size_t j = *(const size_t *) b;
+
+  return (i > j) - (i < j);
+}
+
+/**
+ * @return True if this TableView is sorted by its sort column's Comparator, false otherwise.
+ */
+static bool isSorted(const TableView *self) {
+
+  const TableColumn *column = self->sortColumn;
+
+  return column && column->comparator && column->order != OrderSame;
+}
+
+/**
+ * @brief Discards the cached sort keys, so that the next sort requests them again.
+ */
+static void invalidateSort(TableView *self) {
+
+  free(self->sortKeys);
+  self->sortKeys = NULL;
+
+  release(self->retainedSortKeys);
+  self->retainedSortKeys = NULL;
+
+  self->sortOrder = OrderSame;
+}
+
+/**
+ * @brief Discards the row permutation and the cached sort keys, after rows were added, removed or
+ * moved, so that the next sort begins from the data source order.
+ */
+static void resetSort(TableView *self) {
+
+  free(self->rowPermutation);
+  self->rowPermutation = NULL;
+
+  invalidateSort(self);
+}
+
+/**
+ * @brief Stable, bottom-up merge sort of the data source rows in `rows` by their `keys`.
+ */
+static void mergeSort(size_t *rows, size_t count, const ident *keys, Comparator comparator, Order order) {
+
+  size_t *scratch = malloc(count * sizeof(size_t));
+  assert(scratch);
+
+  size_t *in = rows, *out = scratch;
+
+  for (size_t width = 1; width < count; width *= 2) {
+    for (size_t low = 0; low < count; low += 2 * width) {
+
+      const size_t mid = min(low + width, count);
+      const size_t high = min(low + 2 * width, count);
+
+      size_t l = low, r = mid, k = low;
+      while (l < mid && r < high) {
+        if (comparator(keys[in[r]], keys[in[l]]) == order) {
+          out[k++] = in[r++];
+        } else {
+          out[k++] = in[l++];
+        }
+      }
+
+      while (l < mid) {
+        out[k++] = in[l++];
+      }
+
+      while (r < high) {
+        out[k++] = in[r++];
+      }
+    }
+
+    size_t *swap = in;
+    in = out;
+    out = swap;
+  }
+
+  if (in != rows) {
+    memcpy(rows, in, count * sizeof(size_t));
+  }
+
+  free(scratch);
+}
+
+/**
+ * @brief Updates the row permutation for the sort column and order.
+ * @remarks The sort keys are requested from the data source once, and retained until they are
+ * invalidated. Reversing the order of a sorted TableView reverses the permutation in linear time.
+ * Otherwise, the current permutation is sorted stably, so that rows which tie on the sort column
+ * keep their previous order.
+ */
+static void updateSort(TableView *self) {
+
+  if (isSorted(self) == false) {
+    resetSort(self);
+    return;
+  }
+
+  const TableColumn *column = self->sortColumn;
+  if (self->sortOrder == column->order) {
+    return;
+  }
+
+  const size_t count = self->numberOfRows;
+
+  if (self->rowPermutation && self->sortOrder == (Order) -column->order) {
+    for (size_t i = 0, j = count - 1; i < j; i++, j--) {
+      const size_t row = self->rowPermutation[i];
+      self->rowPermutation[i] = self->rowPermutation[j];
+      self->rowPermutation[j] = row;
+    }
+
+    self->sortOrder = column->order;
+    return;
+  }
+
+  if (count) {
+
+    if (self->sortKeys == NULL) {
+      assert(self->dataSource.valueForColumnAndRow);
+
+      self->sortKeys = malloc(count * sizeof(ident));
+      assert(self->sortKeys);
+
+      for (size_t i = 0; i < count; i++) {
+        self->sortKeys[i] = self->dataSource.valueForColumnAndRow(self, column, i);
+      }
+
+      if (column->retainsValues) {
+        self->retainedSortKeys = $$(Array, arrayWithCapacity, count);
+        assert(self->retainedSortKeys);
+
+        for (size_t i = 0; i < count; i++) {
+          if (self->sortKeys[i]) {
+            $(self->retainedSortKeys, addObject, self->sortKeys[i]);
+          }
+        }
+      }
+    }
+
+    if (self->rowPermutation == NULL) {
+      self->rowPermutation = malloc(count * sizeof(size_t));
+      assert(self->rowPermutation);
+
+      for (size_t i = 0; i < count; i++) {
+        self->rowPermutation[i] = i;
+      }
+    }
+
+    mergeSort(self->rowPermutation, count, self->sortKeys, column->comparator, column->order);
+  }
+
+  self->sortOrder = column->order;
+}
+
+/**
+ * @brief Maps the given rows through `permutation`.
+ * @param rows The rows.
+ * @param permutation The permutation, or `NULL` for the identity.
+ * @return A new RangeSet containing the mapped rows.
+ */
+static RangeSet *permuteRows(const RangeSet *rows, const size_t *permutation) {
+
+  RangeSet *permuted = $(alloc(RangeSet), init);
+  assert(permuted);
+
+  if (permutation == NULL) {
+    for (size_t i = 0; i < rows->numRanges; i++) {
+      $(permuted, addIndexesInRange, rows->ranges[i]);
+    }
+  } else if (rows->count) {
+
+    size_t *indexes = malloc(rows->count * sizeof(size_t));
+    assert(indexes);
+
+    size_t count = 0;
+
+    for (size_t i = 0; i < rows->numRanges; i++) {
+      const Range range = rows->ranges[i];
+      for (size_t j = 0; j < range.length; j++) {
+        indexes[count++] = permutation[range.location + j];
+      }
+    }
+
+    qsort(indexes, count, sizeof(size_t), compareRows);
+
+    for (size_t i = 0; i < count; i++) {
+      $(permuted, addIndex, indexes[i]);
+    }
+
+    free(indexes);
+  }
+
+  return permuted;
+}
+
+/**
+ * @return A new RangeSet containing the data source rows of the selection.
+ */
+static RangeSet *selectedSourceRows(const TableView *self) {
+  return permuteRows(self->selectedRows, self->rowPermutation);
+}
+
+/**
+ * @brief Sorts the rows, and repopulates the instantiated rows in their new order.
+ * @param self The TableView.
+ * @param selection The data source rows of the selection.
+ * @remarks Instantiated rows are retained, and their cells are recycled.
+ */
+static void applySort(TableView *self, const RangeSet *selection) {
+
+  updateSort(self);
+
+  size_t *inverse = NULL;
+  if (self->rowPermutation) {
+    inverse = malloc(self->numberOfRows * sizeof(size_t));
+    assert(inverse);
+
+    for (size_t i = 0; i < self->numberOfRows; i++) {
+      inverse[self->rowPermutation[i]] = i;
+    }
+  }
+
+  release(self->selectedRows);
+  self->selectedRows = permuteRows(selection, inverse);
+
+  free(inverse);
+
+  self->selectionAnchor = -1;
+
+  updateRowOffsets(self);
+
+  const Array *rows = (Array *) self->rows;
+
+  ssize_t *mapped = malloc(rows->count * sizeof(ssize_t));
+  assert(mapped || rows->count == 0);
+
+  for (size_t i = 0; i < rows->count; i++) {
+
+    const size_t row = self->firstRow + i;
+    if (row < self->numberOfRows) {
+      repopulateRow(self, rows->elements[i], row);
+      mapped[i] = row;
+    } else {
+      mapped[i] = -1;
+    }
+  }
+
+  updateRows(self, mapped);
+
+  free(mapped);
+}
+
+/**
+ * @return The index of `index` after the row at `from` was moved to `to`.
+ */
+static size_t indexAfterMove(size_t from, size_t to, size_t index) {
+
+  if (index == from) {
+    return to;
+  } else if (from < to && index > from && index <= to) {
+    return index - 1;
+  } else if (to < from && index >= to && index < from) {
+    return index + 1;
+  }
+
+  return index;
+}
+
+/**
+ * @brief Shifts the given selection to account for the rows inserted at `indexes`.
+ */
+static void insertSelectedRows(RangeSet *selection, const IndexSet *indexes) {
+
+  for (size_t i = 0; i < indexes->count;) {
+
+    size_t j = i + 1;
+    while (j < indexes->count && indexes->indexes[j] == indexes->indexes[j - 1] + 1) {
+      j++;
+    }
+
+    $(selection, insertIndexesInRange, (Range) { .location = indexes->indexes[i], .length = j - i });
+    i = j;
+  }
+}
+
+/**
+ * @brief Removes and shifts the given selection to account for the rows deleted at `indexes`.
+ */
+static void deleteSelectedRows(RangeSet *selection, const IndexSet *indexes) {
+
+  for (size_t i = indexes->count; i > 0;) {
+
+    size_t j = i - 1;
+    while (j > 0 && indexes->indexes[j - 1] + 1 == indexes->indexes[j]) {
+      j--;
+    }
+
+    $(selection, deleteIndexesInRange, (Range) { .location = indexes->indexes[j], .length = i - j });
+    i = j;
+  }
+}
+
+/**
+ * @brief Shifts the given selection to account for the row at `from` moving to `to`.
+ */
+static void moveSelectedRow(RangeSet *selection, size_t from, size_t to) {
+
+  const bool isSelected = $(selection, containsIndex, from);
+
+  $(selection, deleteIndexesInRange, (Range) { .location = from, .length = 1 });
+  $(selection, insertIndexesInRange, (Range) { .location = to, .length = 1 });
+
+  if (isSelected) {
+    $(selection, addIndex, to);
+  }
+}
+
+/**
+ * @brief Passes the data source rows of the given rows to a prefetching callback.
+ */
+static void notifyPrefetching(TableView *self, void (*callback)(const TableView *, const IndexSet *), size_t *rows, size_t count) {
+
+  if (callback && count) {
+
+    for (size_t i = 0; i < count; i++) {
+      rows[i] = $(self, sourceRow, rows[i]);
+    }
+
+    qsort(rows, count, sizeof(size_t), compareRows);
+
+    IndexSet *indexes = $(alloc(IndexSet), initWithIndexes, rows, count);
+    assert(indexes);
+
+    callback(self, indexes);
+
+    release(indexes);
+  }
+}
+
+/**
+ * @brief Prefetches the rows ahead of the visible region in the direction of scrolling, and
+ * cancels prefetched rows that are no longer ahead of it.
+ * @param self The TableView.
+ * @param first The first instantiated row.
+ * @param last One past the last instantiated row.
+ */
+static void prefetchRows(TableView *self, size_t first, size_t last) {
+
+  if (self->dataSource.prefetchRowsAtIndexes == NULL) {
+    return;
+  }
+
+  const int top = -self->scrollView->contentOffset.y;
+  const int delta = top - self->prefetchOffset;
+
+  if (delta == 0) {
+    return;
+  }
+
+  self->prefetchOffset = top;
+
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+  const int distance = min(abs(delta) * PREFETCH_FRAMES, 2 * bounds.h);
+
+  size_t from, to;
+  if (delta > 0) {
+    from = to = last;
+    if (last < self->numberOfRows) {
+      to = rowAtOffset(self, offsetOfRow(self, last) + distance) + 1;
+    }
+  } else {
+    from = to = first;
+    if (first > 0) {
+      from = rowAtOffset(self, offsetOfRow(self, first) - distance);
+    }
+  }
+
+  from = min(from, to);
+
+  const size_t oldFrom = self->prefetchedRows.location;
+  const size_t oldTo = oldFrom + self->prefetchedRows.length;
+
+  self->prefetchedRows = (Range) { .location = from, .length = to - from };
+
+  if (oldTo - oldFrom + to - from == 0) {
+    return;
+  }
+
+  size_t *rows = malloc((oldTo - oldFrom + to - from) * sizeof(size_t));
+  assert(rows);
+
+  size_t count = 0;
+  for (size_t i = oldFrom; i < oldTo && i < self->numberOfRows; i++) {
+    if ((i < from || i >= to) && (i < first || i >= last)) {
+      rows[count++] = i;
+    }
+  }
+
+  notifyPrefetching(self, self->dataSource.cancelPrefetchingForRowsAtIndexes, rows, count);
+
+  count = 0;
+  for (size_t i = from; i < to; i++) {
+    if (i < oldFrom || i >= oldTo) {
+      rows[count++] = i;
+    }
+  }
+
+  notifyPrefetching(self, self->dataSource.prefetchRowsAtIndexes, rows, count);
+
+  free(rows);
+}
+
+/**
+ * @brief Instantiates the rows in and near the visible region of a virtualized TableView, and
+ * recycles the rest.
+ * @remarks The content View is padded to the offset of the first row, and to the height of the
+ * rows following the last, so that its size and scroll position reflect all rows. The first row
+ * is always even, so that structural pseudo-classes such as `nth-child` match consistently.
  */
-static void dealloc(Object *self) {
+static void layoutVisibleRows(TableView *self) {
 
-  TableView *this = (TableView *) self;
+  View *contentView = (View *) self->contentView;
+  ViewPadding *padding = &contentView->padding;
 
-  memset(&this->delegate, 0, sizeof(this->delegate));
+  if (padding->top != self->contentPadding.top + self->spacers.top) {
+    self->contentPadding.top = padding->top;
+  }
 
-  release(this->columns);
-  release(this->contentView);
-  release(this->headerView);
-  release(this->rows);
-  release(this->scrollView);
+  if (padding->bottom != self->contentPadding.bottom + self->spacers.bottom) {
+    self->contentPadding.bottom = padding->bottom;
+  }
 
-  super(Object, self, dealloc);
-}
+  const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+  const int top = -self->scrollView->contentOffset.y - self->contentPadding.top;
 
-#pragma mark - View
+  size_t first = 0, last = 0;
+  if (self->numberOfRows) {
+    const size_t a = rowAtOffset(self, top);
+    const size_t b = rowAtOffset(self, top + bounds.h);
 
-/**
- * @brief ArrayEnumerator for awaking TableColumns.
- */
-static void awakeWithDictionary_columns(const Array *array, ident obj, ident data) {
+    first = a > self->overscan ? a - self->overscan : 0;
+    first &= ~((size_t) 1);
 
-  const String *identifier = $((Dictionary *) obj, objectForKeyPath, "identifier");
-  assert(identifier);
+    last = min(b + self->overscan + 1, self->numberOfRows);
+  }
 
-  TableColumn *column = $(alloc(TableColumn), initWithIdentifier, identifier->chars);
-  assert(column);
+  self->spacers.top = offsetOfRow(self, first);
+  self->spacers.bottom = offsetOfRow(self, self->numberOfRows) - offsetOfRow(self, last);
 
-  $((TableView *) data, addColumn, column);
+  const int paddingTop = self->contentPadding.top + self->spacers.top;
+  const int paddingBottom = self->contentPadding.bottom + self->spacers.bottom;
 
-  release(column);
-}
+  if (padding->top != paddingTop || padding->bottom != paddingBottom) {
+    padding->top = paddingTop;
+    padding->bottom = paddingBottom;
+    contentView->needsLayout = true;
+  }
 
-/**
- * @see View::awakeWithDictionary(View *, const Dictionary *)
- */
-static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
+  prefetchRows(self, first, last);
 
-  super(View, self, awakeWithDictionary, dictionary);
+  const Array *rows = (Array *) self->rows;
 
-  const Array *columns = $(dictionary, objectForKeyPath, "columns");
-  if (columns) {
-    $(columns, enumerate, awakeWithDictionary_columns, self);
+  const size_t oldFirst = self->firstRow;
+  const size_t oldLast = oldFirst + rows->count;
+
+  if (first == oldFirst && last == oldLast) {
+    return;
+  }
+
+  for (size_t i = 0; i < rows->count; i++) {
+    const size_t row = oldFirst + i;
+    if (row < first || row >= last) {
+      enqueueReusableRow(self, rows->elements[i], last - first);
+    }
+  }
+
+  Array *visibleRows = $$(Array, arrayWithCapacity, last - first);
+  assert(visibleRows);
+
+  Theme *theme = contentView->window ? $$(Theme, theme, contentView->window) : NULL;
+
+  View *previous = NULL;
+  for (size_t i = first; i < last; i++) {
+
+    TableRowView *row;
+    if (i >= oldFirst && i < oldLast) {
+      row = retain(rows->elements[i - oldFirst]);
+    } else {
+      row = createRow(self, i);
+
+      if (previous) {
+        $(contentView, addSubviewRelativeTo, (View *) row, previous, ViewPositionAfter);
+      } else {
+        View *next = $((Array *) contentView->subviews, firstObject);
+        $(contentView, addSubviewRelativeTo, (View *) row, next, ViewPositionBefore);
+      }
+
+      if (theme) {
+        $((View *) row, applyThemeIfNeeded, theme);
+      }
+    }
+
+    $(visibleRows, addObject, row);
+    release(row);
+
+    previous = (View *) row;
   }
+
+  release(self->rows);
+  self->rows = visibleRows;
+  self->firstRow = first;
 }
 
 /**
- * @see View::init(View *)
+ * @see View::layoutIfNeeded(View *)
  */
-static View *init(View *self) {
-  return (View *) $((TableView *) self, initWithFrame, NULL);
+static void layoutIfNeeded(View *self) {
+
+  TableView *this = (TableView *) self;
+
+  if (this->virtualized) {
+    layoutVisibleRows(this);
+  }
+
+  super(View, self, layoutIfNeeded);
 }
 
 /**
@@ -128,6 +1045,27 @@ static SDL_Size sizeThatFits(const View *self) {
 
 #pragma mark - Control
 
+/**
+ * @brief Selects the rows between the selection anchor and the specified row, inclusive.
+ */
+static void selectRowsFromAnchor(TableView *self, size_t index) {
+
+  const size_t anchor = self->selectionAnchor;
+
+  const size_t first = min(anchor, index);
+  const size_t last = max(anchor, index);
+
+  $(self->selectedRows, addIndexesInRange, (Range) { .location = first, .length = last - first + 1 });
+
+  const Array *rows = (Array *) self->rows;
+  for (size_t i = 0; i < rows->count; i++) {
+
+    const size_t row = self->firstRow + i;
+    if (row >= first && row <= last) {
+      $((TableRowView *) rows->elements[i], setSelected, true);
+    }
+  }
+}
 
 /**
  * @see Control::captureEvent(Control *, const SDL_Event *)
@@ -162,31 +1100,34 @@ static bool captureEvent(Control *self, const SDL_Event *event) {
         };
 
         const ssize_t index = $(this, rowAtPoint, &point);
+        if (index > -1 && index < (ssize_t) this->numberOfRows) {
 
-        const Array *rows = (Array *) this->rows;
-        if (index > -1 && index < (ssize_t) rows->count) {
-
-          TableRowView *row = $(rows, objectAtIndex, index);
+          const bool isSelected = $(this, isRowSelected, index);
 
           switch (this->control.selection) {
             case ControlSelectionNone:
               break;
             case ControlSelectionSingle:
-              if (row->isSelected == false) {
+              if (isSelected == false) {
                 $(this, deselectAll);
                 $(this, selectRowAtIndex, index);
               }
               break;
             case ControlSelectionMultiple:
-              if (SDL_GetModState() & (SDL_KMOD_CTRL | SDL_KMOD_GUI)) {
-                if (row->isSelected) {
+              if ((SDL_GetModState() & SDL_KMOD_SHIFT) && this->selectionAnchor > -1) {
+                $(this, deselectAll);
+                selectRowsFromAnchor(this, index);
+              } else if (SDL_GetModState() & (SDL_KMOD_CTRL | SDL_KMOD_GUI)) {
+                if (isSelected) {
                   $(this, deselectRowAtIndex, index);
                 } else {
                   $(this, selectRowAtIndex, index);
                 }
+                this->selectionAnchor = index;
               } else {
                 $(this, deselectAll);
                 $(this, selectRowAtIndex, index);
+                this->selectionAnchor = index;
               }
               break;
           }
@@ -238,6 +1179,18 @@ static void addColumnWithIdentifier(TableView *self, const char *identifier) {
   release(column);
 }
 
+/**
+ * @fn TableCellView *TableView::cloneCellPrototype(const TableView *self, const TableColumn *column)
+ * @memberof TableView
+ */
+static TableCellView *cloneCellPrototype(const TableView *self, const TableColumn *column) {
+
+  assert(column);
+  assert(column->prototype);
+
+  return (TableCellView *) $((View *) column->prototype, clone);
+}
+
 /**
  * @fn TableColumn *TableView::columnAtPoint(const TableView *self, const SDL_Point *point)
  * @memberof TableView
@@ -252,13 +1205,26 @@ static TableColumn *columnAtPoint(const TableView *self, const SDL_Point *point)
 
     assert(cells->count == columns->count);
 
-    for (size_t i = 0; i < cells->count; i++) {
+    const View *headerView = (View *) self->headerView;
+    const SDL_Rect headerFrame = $(headerView, renderFrame);
+
+    const int x = point->x - headerFrame.x - headerView->padding.left;
 
-      const View *cell = $(cells, objectAtIndex, i);
-      const SDL_Rect renderFrame = $(cell, renderFrame);
+    size_t low = 0, high = cells->count;
+    while (low < high) {
+      const size_t mid = low + (high - low) / 2;
+      const View *cell = cells->elements[mid];
+      if (cell->frame.x + cell->frame.w <= x) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
 
-      if (renderFrame.x + renderFrame.w >= point->x) {
-        return $(columns, objectAtIndex, i);
+    if (low < columns->count) {
+      const View *cell = cells->elements[low];
+      if (x >= cell->frame.x) {
+        return $(columns, objectAtIndex, low);
       }
     }
   }
@@ -286,6 +1252,71 @@ static TableColumn *columnWithIdentifier(const TableView *self, const char *iden
   return NULL;
 }
 
+/**
+ * @fn void TableView::deleteRowsAtIndexes(TableView *self, const IndexSet *indexes)
+ * @memberof TableView
+ */
+static void deleteRowsAtIndexes(TableView *self, const IndexSet *indexes) {
+
+  if (indexes == NULL || indexes->count == 0) {
+    return;
+  }
+
+  self->numberOfRows = self->dataSource.numberOfRows(self);
+
+  if (isSorted(self)) {
+    RangeSet *selection = selectedSourceRows(self);
+    deleteSelectedRows(selection, indexes);
+
+    resetSort(self);
+    applySort(self, selection);
+
+    release(selection);
+    return;
+  }
+
+  deleteSelectedRows(self->selectedRows, indexes);
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterDeletion(indexes, self->selectionAnchor);
+  }
+
+  updateRowOffsets(self);
+
+  const Array *rows = (Array *) self->rows;
+
+  ssize_t *mapped = malloc(rows->count * sizeof(ssize_t));
+  assert(mapped || rows->count == 0);
+
+  for (size_t i = 0; i < rows->count; i++) {
+    mapped[i] = indexAfterDeletion(indexes, self->firstRow + i);
+  }
+
+  updateRows(self, mapped);
+
+  free(mapped);
+}
+
+/**
+ * @fn TableCellView *TableView::dequeueReusableCell(const TableView *self, const TableColumn *column)
+ * @memberof TableView
+ */
+static TableCellView *dequeueReusableCell(const TableView *self, const TableColumn *column) {
+
+  assert(column);
+
+  Array *reusableCells = $(self->reusableCells, objectForKey, (ident) column);
+  if (reusableCells && reusableCells->count) {
+
+    TableCellView *cell = retain($((Array *) reusableCells, lastObject));
+    $(reusableCells, removeObjectAtIndex, reusableCells->count - 1);
+
+    return cell;
+  }
+
+  return NULL;
+}
+
 /**
  * @brief ArrayEnumerator for all Row deselection.
  */
@@ -298,6 +1329,9 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void deselectAll(TableView *self) {
+
+  $(self->selectedRows, removeAllIndexes);
+
   $((Array *) self->rows, enumerate, deselectAll_enumerate, NULL);
 }
 
@@ -307,11 +1341,14 @@ static void deselectAll(TableView *self) {
  */
 static void deselectRowAtIndex(TableView *self, size_t index) {
 
-  const Array *rows = (Array *) self->rows;
-  if (index < rows->count) {
+  if ($(self->selectedRows, containsIndex, index)) {
 
-    TableRowView *row = $(rows, objectAtIndex, index);
-    $(row, setSelected, false);
+    $(self->selectedRows, removeIndex, index);
+
+    TableRowView *row = visibleRow(self, index);
+    if (row) {
+      $(row, setSelected, false);
+    }
   }
 }
 
@@ -342,6 +1379,20 @@ static TableView *initWithFrame(TableView *self, const SDL_Rect *frame) {
     self->rows = $$(Array, array);
     assert(self->rows);
 
+    self->reusableCells = $$(Dictionary, dictionary);
+    assert(self->reusableCells);
+
+    self->reusableRows = $$(Array, array);
+    assert(self->reusableRows);
+
+    self->selectedRows = $(alloc(RangeSet), init);
+    assert(self->selectedRows);
+
+    self->selectionAnchor = -1;
+
+    self->overscan = 4;
+    self->rowHeight = 24;
+
     self->headerView = $(alloc(TableHeaderView), initWithTableView, self);
     assert(self->headerView);
 
@@ -363,6 +1414,103 @@ static TableView *initWithFrame(TableView *self, const SDL_Rect *frame) {
   return self;
 }
 
+/**
+ * @fn void TableView::insertRowsAtIndexes(TableView *self, const IndexSet *indexes)
+ * @memberof TableView
+ */
+static void insertRowsAtIndexes(TableView *self, const IndexSet *indexes) {
+
+  if (indexes == NULL || indexes->count == 0) {
+    return;
+  }
+
+  self->numberOfRows = self->dataSource.numberOfRows(self);
+
+  if (isSorted(self)) {
+    RangeSet *selection = selectedSourceRows(self);
+    insertSelectedRows(selection, indexes);
+
+    resetSort(self);
+    applySort(self, selection);
+
+    release(selection);
+    return;
+  }
+
+  insertSelectedRows(self->selectedRows, indexes);
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterInsertion(indexes, self->selectionAnchor);
+  }
+
+  updateRowOffsets(self);
+
+  const Array *rows = (Array *) self->rows;
+
+  ssize_t *mapped = malloc(rows->count * sizeof(ssize_t));
+  assert(mapped || rows->count == 0);
+
+  for (size_t i = 0; i < rows->count; i++) {
+    mapped[i] = indexAfterInsertion(indexes, self->firstRow + i);
+  }
+
+  updateRows(self, mapped);
+
+  free(mapped);
+}
+
+/**
+ * @fn bool TableView::isRowSelected(const TableView *self, size_t row)
+ * @memberof TableView
+ */
+static bool isRowSelected(const TableView *self, size_t row) {
+  return $(self->selectedRows, containsIndex, row);
+}
+
+/**
+ * @fn void TableView::moveRow(TableView *self, size_t from, size_t to)
+ * @memberof TableView
+ */
+static void moveRow(TableView *self, size_t from, size_t to) {
+
+  if (from == to || from >= self->numberOfRows || to >= self->numberOfRows) {
+    return;
+  }
+
+  if (isSorted(self)) {
+    RangeSet *selection = selectedSourceRows(self);
+    moveSelectedRow(selection, from, to);
+
+    resetSort(self);
+    applySort(self, selection);
+
+    release(selection);
+    return;
+  }
+
+  moveSelectedRow(self->selectedRows, from, to);
+
+  if (self->selectionAnchor > -1) {
+    self->selectionAnchor = indexAfterMove(from, to, self->selectionAnchor);
+  }
+
+  updateRowOffsets(self);
+
+  const Array *rows = (Array *) self->rows;
+
+  ssize_t *mapped = malloc(rows->count * sizeof(ssize_t));
+  assert(mapped || rows->count == 0);
+
+  for (size_t i = 0; i < rows->count; i++) {
+    const size_t row = self->firstRow + i;
+    mapped[i] = row == from ? -1 : (ssize_t) indexAfterMove(from, to, row);
+  }
+
+  updateRows(self, mapped);
+
+  free(mapped);
+}
+
 /**
  * @fn SDL_Size TableView::naturalSize(const TableView *self)
  * @memberof TableView
@@ -382,13 +1530,6 @@ static SDL_Size naturalSize(const TableView *self) {
   return size;
 }
 
-/**
- * @brief ArrayEnumerator to remove TableRowViews from the table's contentView.
- */
-static void reloadData_removeRows(const Array *array, ident obj, ident data) {
-  $((View *) data, removeSubview, (View *) obj);
-}
-
 /**
  * @fn void TableView::reloadData(TableView *self)
  * @memberof TableView
@@ -396,9 +1537,14 @@ static void reloadData_removeRows(const Array *array, ident obj, ident data) {
 static void reloadData(TableView *self) {
 
   assert(self->dataSource.numberOfRows);
-  assert(self->delegate.cellForColumnAndRow);
 
-  $(self->rows, removeAllObjectsWithEnumerator, reloadData_removeRows, self->contentView);
+  const Array *rows = (Array *) self->rows;
+  for (size_t i = rows->count; i > 0; i--) {
+    enqueueReusableRow(self, rows->elements[i - 1], rows->count);
+  }
+
+  $(self->rows, removeAllObjects);
+  self->firstRow = 0;
 
   TableRowView *headerView = (TableRowView *) self->headerView;
   $(headerView, removeAllCells);
@@ -410,33 +1556,76 @@ static void reloadData(TableView *self) {
     $(headerView, addCell, (TableCellView *) column->headerCell);
   }
 
-  const size_t numberOfRows = self->dataSource.numberOfRows(self);
-  for (size_t i = 0; i < numberOfRows; i++) {
+  self->numberOfRows = self->dataSource.numberOfRows(self);
 
-    TableRowView *row = $(alloc(TableRowView), initWithTableView, self);
-    assert(row);
+  $(self->selectedRows, removeAllIndexes);
+  self->selectionAnchor = -1;
 
-    for (size_t j = 0; j < columns->count; j++) {
-      const TableColumn *column = $(columns, objectAtIndex, j);
+  resetPrefetching(self);
 
-      TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, i);
-      assert(cell);
+  resetSort(self);
+  updateSort(self);
 
-      cell->view.identifier = strdup(column->identifier);
+  updateRowOffsets(self);
 
-      $(row, addCell, cell);
-      release(cell);
-    }
+  if (self->virtualized) {
+    layoutVisibleRows(self);
+  } else {
 
-    $(self->rows, addObject, row);
-    release(row);
+    for (size_t i = 0; i < self->numberOfRows; i++) {
 
-    $((View *) self->contentView, addSubview, (View *) row);
+      TableRowView *row = createRow(self, i);
+
+      $(self->rows, addObject, row);
+      $((View *) self->contentView, addSubview, (View *) row);
+
+      release(row);
+    }
+
+    $(self->reusableCells, removeAllObjects);
+    $(self->reusableRows, removeAllObjects);
   }
 
   self->control.view.needsLayout = true;
 }
 
+/**
+ * @fn void TableView::reloadRowsAtIndexes(TableView *self, const IndexSet *indexes)
+ * @memberof TableView
+ */
+static void reloadRowsAtIndexes(TableView *self, const IndexSet *indexes) {
+
+  if (indexes == NULL || indexes->count == 0) {
+    return;
+  }
+
+  if (isSorted(self)) {
+    RangeSet *selection = selectedSourceRows(self);
+
+    invalidateSort(self);
+    applySort(self, selection);
+
+    release(selection);
+    return;
+  }
+
+  if (self->rowOffsets) {
+    updateRowOffsets(self);
+  }
+
+  for (size_t i = 0; i < indexes->count; i++) {
+
+    TableRowView *row = visibleRow(self, indexes->indexes[i]);
+    if (row) {
+      repopulateRow(self, row, indexes->indexes[i]);
+    }
+  }
+
+  if (self->virtualized == false) {
+    $(self->reusableCells, removeAllObjects);
+  }
+}
+
 /**
  * @fn void TableView::removeColumn(TableView *self, TableColumn *column)
  * @memberof TableView
@@ -450,6 +1639,8 @@ static void removeColumn(TableView *self, TableColumn *column) {
     self->sortColumn = NULL;
   }
 
+  $(self->reusableCells, removeObjectForKey, column);
+
   $(self->columns, removeObject, column);
 
   $((TableRowView *) self->headerView, removeCell, (TableCellView *) column->headerCell);
@@ -464,12 +1655,36 @@ static ssize_t rowAtPoint(const TableView *self, const SDL_Point *point) {
   const SDL_Rect scrollFrame = $((View *) self->scrollView, renderFrame);
   if (SDL_PointInRect(point, &scrollFrame)) {
 
-    const Array *rows = (Array *) self->rows;
-    for (size_t i = 0; i < rows->count; i++) {
+    const View *contentView = (View *) self->contentView;
+    const SDL_Rect contentFrame = $(contentView, renderFrame);
 
-      const View *row = $(rows, objectAtIndex, i);
-      if ($(row, containsPoint, point)) {
-        return i;
+    const int y = point->y - contentFrame.y;
+
+    if (self->virtualized) {
+      const int offset = y - self->contentPadding.top;
+      if (offset >= 0 && offset < offsetOfRow(self, self->numberOfRows)) {
+        return rowAtOffset(self, offset);
+      }
+    } else {
+      const Array *rows = (Array *) self->rows;
+      const int offset = y - contentView->padding.top;
+
+      size_t low = 0, high = rows->count;
+      while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        const View *row = rows->elements[mid];
+        if (row->frame.y + row->frame.h <= offset) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+
+      if (low < rows->count) {
+        const View *row = rows->elements[low];
+        if (offset >= row->frame.y) {
+          return self->firstRow + low;
+        }
       }
     }
   }
@@ -489,6 +1704,10 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void selectAll(TableView *self) {
+
+  $(self->selectedRows, removeAllIndexes);
+  $(self->selectedRows, addIndexesInRange, (Range) { .location = 0, .length = self->numberOfRows });
+
   $((Array *) self->rows, enumerate, selectAll_enumerate, NULL);
 }
 
@@ -497,20 +1716,7 @@ static void selectAll(TableView *self) {
  * @memberof TableView
  */
 static IndexSet *selectedRowIndexes(const TableView *self) {
-
-  size_t indexes[self->rows->count];
-  size_t count = 0;
-
-  const Array *rows = (Array *) self->rows;
-  for (size_t i = 0; i < rows->count; i++) {
-
-    const TableRowView *row = $(rows, objectAtIndex, i);
-    if (row->isSelected) {
-      indexes[count++] = i;
-    }
-  }
-
-  return $(alloc(IndexSet), initWithIndexes, indexes, count);
+  return $(self->selectedRows, indexSet);
 }
 
 /**
@@ -519,11 +1725,12 @@ static IndexSet *selectedRowIndexes(const TableView *self) {
  */
 static void selectRowAtIndex(TableView *self, size_t index) {
 
-  const Array *rows = (Array *) self->rows;
-  if (index < rows->count) {
+  if (index < self->numberOfRows) {
 
-    TableRowView *row = $(rows, objectAtIndex, index);
-    if (!row->isSelected) {
+    $(self->selectedRows, addIndex, index);
+
+    TableRowView *row = visibleRow(self, index);
+    if (row && !row->isSelected) {
       $(row, setSelected, true);
     }
   }
@@ -548,8 +1755,12 @@ static void selectRowsAtIndexes(TableView *self, const IndexSet *indexes) {
  */
 static void setSortColumn(TableView *self, TableColumn *column) {
 
+  RangeSet *selection = selectedSourceRows(self);
+
   if (self->sortColumn != column) {
 
+    invalidateSort(self);
+
     if (self->sortColumn) {
       self->sortColumn->order = OrderSame;
       self->sortColumn = NULL;
@@ -567,11 +1778,31 @@ static void setSortColumn(TableView *self, TableColumn *column) {
     }
   }
 
+  if (isSorted(self) || self->rowPermutation) {
+    applySort(self, selection);
+  }
+
+  release(selection);
+
   if (self->delegate.didSetSortColumn) {
     self->delegate.didSetSortColumn(self);
   }
 }
 
+/**
+ * @fn size_t TableView::sourceRow(const TableView *self, size_t row)
+ * @memberof TableView
+ */
+static size_t sourceRow(const TableView *self, size_t row) {
+
+  if (self->rowPermutation) {
+    assert(row < self->numberOfRows);
+    return self->rowPermutation[row];
+  }
+
+  return row;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -583,6 +1814,7 @@ static void initialize(Class *clazz) {
 
   ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
   ((ViewInterface *) clazz->interface)->init = init;
+  ((ViewInterface *) clazz->interface)->layoutIfNeeded = layoutIfNeeded;
   ((ViewInterface *) clazz->interface)->layoutSubviews = layoutSubviews;
   ((ViewInterface *) clazz->interface)->sizeThatFits = sizeThatFits;
 
@@ -590,14 +1822,21 @@ static void initialize(Class *clazz) {
 
   ((TableViewInterface *) clazz->interface)->addColumn = addColumn;
   ((TableViewInterface *) clazz->interface)->addColumnWithIdentifier = addColumnWithIdentifier;
+  ((TableViewInterface *) clazz->interface)->cloneCellPrototype = cloneCellPrototype;
   ((TableViewInterface *) clazz->interface)->columnAtPoint = columnAtPoint;
   ((TableViewInterface *) clazz->interface)->columnWithIdentifier = columnWithIdentifier;
+  ((TableViewInterface *) clazz->interface)->deleteRowsAtIndexes = deleteRowsAtIndexes;
+  ((TableViewInterface *) clazz->interface)->dequeueReusableCell = dequeueReusableCell;
   ((TableViewInterface *) clazz->interface)->deselectAll = deselectAll;
   ((TableViewInterface *) clazz->interface)->deselectRowAtIndex = deselectRowAtIndex;
   ((TableViewInterface *) clazz->interface)->deselectRowsAtIndexes = deselectRowsAtIndexes;
   ((TableViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
+  ((TableViewInterface *) clazz->interface)->insertRowsAtIndexes = insertRowsAtIndexes;
+  ((TableViewInterface *) clazz->interface)->isRowSelected = isRowSelected;
+  ((TableViewInterface *) clazz->interface)->moveRow = moveRow;
   ((TableViewInterface *) clazz->interface)->naturalSize = naturalSize;
   ((TableViewInterface *) clazz->interface)->reloadData = reloadData;
+  ((TableViewInterface *) clazz->interface)->reloadRowsAtIndexes = reloadRowsAtIndexes;
   ((TableViewInterface *) clazz->interface)->removeColumn = removeColumn;
   ((TableViewInterface *) clazz->interface)->rowAtPoint = rowAtPoint;
   ((TableViewInterface *) clazz->interface)->selectedRowIndexes = selectedRowIndexes;
@@ -605,6 +1844,7 @@ static void initialize(Class *clazz) {
   ((TableViewInterface *) clazz->interface)->selectRowAtIndex = selectRowAtIndex;
   ((TableViewInterface *) clazz->interface)->selectRowsAtIndexes = selectRowsAtIndexes;
   ((TableViewInterface *) clazz->interface)->setSortColumn = setSortColumn;
+  ((TableViewInterface *) clazz->interface)->sourceRow = sourceRow;
 }
 
 /**
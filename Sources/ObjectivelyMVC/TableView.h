@@ -25,8 +25,10 @@
 
 #include <Objectively/IndexSet.h>
 #include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
 
 #include <ObjectivelyMVC/Control.h>
+#include <ObjectivelyMVC/RangeSet.h>
 #include <ObjectivelyMVC/ScrollView.h>
 #include <ObjectivelyMVC/StackView.h>
 #include <ObjectivelyMVC/TableCellView.h>
@@ -72,8 +74,31 @@ struct TableViewDataSource {
    * @param colum The Column.
    * @param row The row number.
    * @return The value for the cell at the given column and row number.
+   * @remarks Values are used as sort keys for columns with a Comparator. They are requested once
+   * per sort, and must remain valid until the next call to `reloadData`, unless the column
+   * `retainsValues`.
    */
   ident (*valueForColumnAndRow)(const TableView *tableView, const TableColumn *column, size_t row);
+
+  /**
+   * @brief Called by the TableView for rows that are about to become visible.
+   * @param tableView The TableView.
+   * @param indexes The row numbers.
+   * @remarks This function is optional. It is called while a virtualized TableView scrolls, for
+   * the rows just beyond the visible region in the direction of scrolling. The faster the
+   * scrolling, the further ahead it reaches. Implementations may begin loading images or preparing
+   * text for these rows, so that their cells are ready when they become visible.
+   */
+  void (*prefetchRowsAtIndexes)(const TableView *tableView, const IndexSet *indexes);
+
+  /**
+   * @brief Called by the TableView for prefetched rows that are no longer about to become
+   * visible, such as when scrolling reverses direction.
+   * @param tableView The TableView.
+   * @param indexes The row numbers.
+   * @remarks This function is optional.
+   */
+  void (*cancelPrefetchingForRowsAtIndexes)(const TableView *tableView, const IndexSet *indexes);
 };
 
 /**
@@ -93,6 +118,9 @@ struct TableViewDelegate {
    * @param column The TableColumn.
    * @param row The row number.
    * @return The cell for the given column and row number.
+   * @remarks Implementations should first attempt to reuse a cell via
+   * `TableView::dequeueReusableCell`, which is essential for virtualized TableViews.
+   * @remarks This is not called for columns with a TableCellRenderer.
    */
   TableCellView *(*cellForColumnAndRow)(const TableView *tableView, const TableColumn *column, size_t row);
 
@@ -108,10 +136,21 @@ struct TableViewDelegate {
    * @brief Called by the TableView when the sort column or order changes.
    * @param tableView The TableView.
    * @remarks This function is optional.
-   * @remarks A typical implementation of this function would sort the data set by the sort
-   * column's Comparator, and then call `$(tableView, reloadData`).
+   * @remarks If the sort column has a Comparator, the TableView sorts its rows itself before this
+   * function is called. Otherwise, a typical implementation of this function would sort the data
+   * set, and then call `$(tableView, reloadData`).
    */
   void (*didSetSortColumn)(TableView *tableView);
+
+  /**
+   * @brief Called by virtualized TableViews for the height of a row.
+   * @param tableView The TableView.
+   * @param row The row number.
+   * @return The height of the row.
+   * @remarks This function is optional. If not set, all rows are `rowHeight` tall. Heights are
+   * queried on `reloadData`, and whenever rows are inserted, deleted, reloaded or moved.
+   */
+  int (*heightForRow)(const TableView *tableView, size_t row);
 };
 
 /**
@@ -142,6 +181,12 @@ struct TableView {
    */
   StackView *contentView;
 
+  /**
+   * @brief The padding of the content View, excluding `spacers`.
+   * @private
+   */
+  ViewPadding contentPadding;
+
   /**
    * @brief The data source.
    */
@@ -152,13 +197,84 @@ struct TableView {
    */
   TableViewDelegate delegate;
 
+  /**
+   * @brief The row number of the first of `rows`.
+   * @remarks This is always `0` unless this TableView is `virtualized`.
+   */
+  size_t firstRow;
+
   /**
    * @brief The header.
    */
   TableHeaderView *headerView;
 
+  /**
+   * @brief The number of rows, as last reported by the data source.
+   * @private
+   */
+  size_t numberOfRows;
+
+  /**
+   * @brief The number of rows instantiated beyond each edge of the visible region, when
+   * `virtualized`.
+   */
+  size_t overscan;
+
+  /**
+   * @brief The rows passed to `prefetchRowsAtIndexes` which have been neither instantiated nor
+   * cancelled.
+   * @private
+   */
+  Range prefetchedRows;
+
+  /**
+   * @brief The scroll offset at which rows were last prefetched.
+   * @private
+   */
+  int prefetchOffset;
+
+  /**
+   * @brief The `sortKeys` of a sort column that retains its values.
+   * @see TableColumn::retainsValues
+   * @private
+   */
+  Array *retainedSortKeys;
+
+  /**
+   * @brief Arrays of reusable cells, keyed by TableColumn.
+   * @private
+   */
+  Dictionary *reusableCells;
+
+  /**
+   * @brief Reusable rows, with their cells removed.
+   * @private
+   */
+  Array *reusableRows;
+
+  /**
+   * @brief The height of each row, when `virtualized` and the delegate does not provide
+   * `heightForRow`.
+   */
+  int rowHeight;
+
+  /**
+   * @brief The offset of each row, and the total height of all rows, when `virtualized` and the
+   * delegate provides `heightForRow`.
+   * @private
+   */
+  int *rowOffsets;
+
+  /**
+   * @brief The data source row displayed at each row, when sorted by a column's Comparator.
+   * @private
+   */
+  size_t *rowPermutation;
+
   /**
    * @brief The rows.
+   * @remarks When `virtualized`, this contains only the rows in and near the visible region,
+   * beginning with `firstRow`.
    */
   Array *rows;
 
@@ -167,10 +283,50 @@ struct TableView {
    */
   ScrollView *scrollView;
 
+  /**
+   * @brief The selected rows.
+   * @remarks Rows query the selection as they are bound, so that rows which are not instantiated
+   * may be selected as well.
+   */
+  RangeSet *selectedRows;
+
+  /**
+   * @brief The row from which shift-clicks extend the selection, or `-1`.
+   * @private
+   */
+  ssize_t selectionAnchor;
+
   /**
    * @brief The column to sort by.
    */
   TableColumn *sortColumn;
+
+  /**
+   * @brief The values of the sort column, by data source row.
+   * @private
+   */
+  ident *sortKeys;
+
+  /**
+   * @brief The order of `rowPermutation`, or `OrderSame` if it must be recomputed.
+   * @private
+   */
+  Order sortOrder;
+
+  /**
+   * @brief The padding added to the content View in place of the rows that are not instantiated,
+   * when `virtualized`.
+   * @private
+   */
+  ViewPadding spacers;
+
+  /**
+   * @brief If true, rows are instantiated only as they are scrolled into view, and recycled as
+   * they are scrolled out of view.
+   * @remarks Virtualized TableViews allow very large data sets to be presented in constant time
+   * and memory. Rows must be of `rowHeight`, or of the height provided by the delegate.
+   */
+  bool virtualized;
 };
 
 /**
@@ -201,11 +357,24 @@ struct TableViewInterface {
    */
   void (*addColumnWithIdentifier)(TableView *self, const char *identifier);
 
+  /**
+   * @fn TableCellView *TableView::cloneCellPrototype(const TableView *self, const TableColumn *column)
+   * @brief Clones the prototype cell registered with the specified column.
+   * @param self The TableView.
+   * @param column The TableColumn, which must have a prototype cell.
+   * @return A new cell, cloned from the column's prototype.
+   * @remarks This is a convenience for TableViewDelegate::cellForColumnAndRow implementations,
+   * which avoids loading and styling each cell from scratch.
+   * @see TableColumn::setPrototype(TableColumn *, TableCellView *)
+   * @memberof TableView
+   */
+  TableCellView *(*cloneCellPrototype)(const TableView *self, const TableColumn *column);
+
   /**
    * @fn TableColumn *TableView::columnAtPoint(const TableView *self, const SDL_Point *point)
    * @param self The TableView.
    * @param point A point in window coordinate space.
-   * @return The column at the specified point.
+   * @return The column at the specified point, or `NULL` if none.
    * @memberof TableView
    */
   TableColumn *(*columnAtPoint)(const TableView *self, const SDL_Point *point);
@@ -219,6 +388,18 @@ struct TableViewInterface {
    */
   TableColumn *(*columnWithIdentifier)(const TableView *self, const char *identifier);
 
+  /**
+   * @fn TableCellView *TableView::dequeueReusableCell(const TableView *self, const TableColumn *column)
+   * @brief Dequeues a cell that was previously used in the specified column, if available.
+   * @param self The TableView.
+   * @param column The TableColumn.
+   * @return A retained, reusable cell, or `NULL` if none is available.
+   * @remarks The cell retains its subviews and styling, so TableViewDelegate::cellForColumnAndRow
+   * implementations need only update its contents.
+   * @memberof TableView
+   */
+  TableCellView *(*dequeueReusableCell)(const TableView *self, const TableColumn *column);
+
   /**
    * @fn void TableView::deselectAll(TableView *self)
    * @brief Deselects all rows in this TableView.
@@ -245,6 +426,19 @@ struct TableViewInterface {
    */
   void (*deselectRowsAtIndexes)(TableView *self, const IndexSet *indexSet);
 
+  /**
+   * @fn void TableView::deleteRowsAtIndexes(TableView *self, const IndexSet *indexes)
+   * @brief Deletes the rows at the specified indexes, which have already been removed from the
+   * data source.
+   * @param self The TableView.
+   * @param indexes The indexes of the deleted rows, prior to deletion.
+   * @remarks Only the affected rows are updated. The selection and scroll offset are preserved.
+   * If the TableView is sorted by a column's Comparator, `indexes` are data source rows, and the
+   * rows are sorted again.
+   * @memberof TableView
+   */
+  void (*deleteRowsAtIndexes)(TableView *self, const IndexSet *indexes);
+
   /**
    * @fn TableView *TableView::initWithFrame(TableView *self, const SDL_Rect *frame)
    * @brief Initializes this TableView with the specified frame and style.
@@ -255,6 +449,40 @@ struct TableViewInterface {
    */
   TableView *(*initWithFrame)(TableView *self, const SDL_Rect *frame);
 
+  /**
+   * @fn void TableView::insertRowsAtIndexes(TableView *self, const IndexSet *indexes)
+   * @brief Inserts rows at the specified indexes, which have already been added to the data
+   * source.
+   * @param self The TableView.
+   * @param indexes The indexes of the inserted rows, after insertion.
+   * @remarks Only the affected rows are updated. The selection and scroll offset are preserved.
+   * If the TableView is sorted by a column's Comparator, `indexes` are data source rows, and the
+   * rows are sorted again.
+   * @memberof TableView
+   */
+  void (*insertRowsAtIndexes)(TableView *self, const IndexSet *indexes);
+
+  /**
+   * @fn bool TableView::isRowSelected(const TableView *self, size_t row)
+   * @param self The TableView.
+   * @param row The row number.
+   * @return True if the specified row is selected, false otherwise.
+   * @memberof TableView
+   */
+  bool (*isRowSelected)(const TableView *self, size_t row);
+
+  /**
+   * @fn void TableView::moveRow(TableView *self, size_t from, size_t to)
+   * @brief Moves the row at `from` to `to`, where it has already been moved in the data source.
+   * @param self The TableView.
+   * @param from The index of the row prior to the move.
+   * @param to The index of the row after the move.
+   * @remarks The selection and scroll offset are preserved. If the TableView is sorted by a
+   * column's Comparator, `from` and `to` are data source rows, and the rows are sorted again.
+   * @memberof TableView
+   */
+  void (*moveRow)(TableView *self, size_t from, size_t to);
+
   /**
    * @fn SDL_Size TableView::naturalSize(const TableView *self)
    * @param self The TableView.
@@ -266,6 +494,8 @@ struct TableViewInterface {
   /**
    * @fn void TableView::reloadData(TableView *self)
    * @brief Reloads this TableView's visible rows.
+   * @details The rows and cells currently displayed are made available for reuse, and the
+   * selection is cleared.
    * @param self The TableView.
    * @remarks This method must be called after changes to the data source, delegate, or column
    * definitions. Failure to call this method after such changes leads to undefined behavior.
@@ -273,6 +503,17 @@ struct TableViewInterface {
    */
   void (*reloadData)(TableView *self);
 
+  /**
+   * @fn void TableView::reloadRowsAtIndexes(TableView *self, const IndexSet *indexes)
+   * @brief Reloads the cells of the rows at the specified indexes.
+   * @param self The TableView.
+   * @param indexes The indexes of the rows to reload.
+   * @remarks Rows that are not instantiated are not requested from the delegate. If the
+   * TableView is sorted by a column's Comparator, the rows are sorted again.
+   * @memberof TableView
+   */
+  void (*reloadRowsAtIndexes)(TableView *self, const IndexSet *indexes);
+
   /**
    * @fn void TableView::removeColumn(TableView *self, TableColumn *column)
    * @brief Removes the specified column from this table.
@@ -330,9 +571,25 @@ struct TableViewInterface {
    * @brief Sets the sort column for this table.
    * @param self The TableView.
    * @param column The sort column.
+   * @remarks Setting the current sort column again reverses the sort order. If the sort column
+   * has a Comparator, the rows are sorted by their values for that column. The sort is stable, so
+   * rows which tie on the new sort column keep their order from the previous one. The selection
+   * follows the sorted rows.
    * @memberof TableView
    */
   void (*setSortColumn)(TableView *self, TableColumn *column);
+
+  /**
+   * @fn size_t TableView::sourceRow(const TableView *self, size_t row)
+   * @param self The TableView.
+   * @param row A row number.
+   * @return The data source row displayed at `row`.
+   * @remarks Row numbers passed to the data source and delegate are data source rows. All other
+   * row numbers, including those of the selection, are displayed rows. The two differ only when
+   * the TableView is sorted by a column's Comparator.
+   * @memberof TableView
+   */
+  size_t (*sourceRow)(const TableView *self, size_t row);
 };
 
 /**
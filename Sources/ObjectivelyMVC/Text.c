@@ -260,7 +260,7 @@ static String *description(const Object *self) {
   View *this = (View *) self;
   const SDL_Rect bounds = $(this, bounds);
 
-  String *classNames = $((Object *) this->classNames, description);
+  String *classNames = MVC_AtomsDescription(this->classNames, this->numClassNames);
   String *description = str("%s@%p \"%s\" %s [%d, %d, %d, %d]",
                 this->identifier ?: classnameof(self),
                 self,
@@ -283,25 +283,41 @@ static void applyStyle(View *self, const Style *style) {
 
   Text *this = (Text *) self;
 
-  const Inlet colorInlets[] = MakeInlets(
-    MakeInlet("color", InletTypeColor, &this->color, NULL)
-  );
-
-  if ($(self, bind, colorInlets, style->attributes)) {
-    this->texture = release(this->texture);
-    this->textureSize = MakeSize(0, 0);
-  }
-
   char *fontFamily = NULL;
   int fontSize = -1, fontStyle = -1;
 
-  const Inlet fontInlets[] = MakeInlets(
-    MakeInlet("font-family", InletTypeCharacters, &fontFamily, NULL),
-    MakeInlet("font-size", InletTypeInteger, &fontSize, NULL),
-    MakeInlet("font-style", InletTypeEnum, &fontStyle, (ident) FontStyleNames)
-  );
+  bool didBindFont = false;
+
+  for (size_t i = 0; i < style->numValues; i++) {
+
+    StyleValue *value = style->values[i];
+
+    switch (value->property) {
+      case StylePropertyColor:
+        $(value, bind, InletTypeColor, &this->color, NULL);
+        this->texture = release(this->texture);
+        this->textureSize = MakeSize(0, 0);
+        break;
+      case StylePropertyFontFamily:
+        $(value, bind, InletTypeCharacters, &fontFamily, NULL);
+        didBindFont = true;
+        break;
+      case StylePropertyFontSize:
+        $(value, bind, InletTypeInteger, &fontSize, NULL);
+        didBindFont = true;
+        break;
+      case StylePropertyFontStyle:
+        $(value, bind, InletTypeEnum, &fontStyle, (ident) FontStyleNames);
+        didBindFont = true;
+        break;
+      default:
+        continue;
+    }
+
+    self->needsLayout = true;
+  }
 
-  if ($(self, bind, fontInlets, style->attributes)) {
+  if (didBindFont) {
 
     Font *font = $$(Font, cachedFont, fontFamily , fontSize, fontStyle);
     assert(font);
@@ -336,6 +352,42 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
   $(self, sizeToFit);
 }
 
+/**
+ * @see View::awakeWithPrototype(View *, const View *)
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  super(View, self, awakeWithPrototype, prototype);
+
+  Text *this = (Text *) self;
+  const Text *that = (Text *) prototype;
+
+  this->color = that->color;
+  this->colorEscapes = that->colorEscapes;
+  this->lineWrap = that->lineWrap;
+
+  release(this->font);
+  this->font = that->font ? retain(that->font) : NULL;
+
+  free(this->text);
+  this->text = that->text ? strdup(that->text) : NULL;
+
+  release(this->texture);
+  this->texture = that->texture ? retain(that->texture) : NULL;
+  this->textureSize = that->textureSize;
+}
+
+/**
+ * @see View::evictTextures(View *)
+ */
+static void evictTextures(View *self) {
+
+  Text *this = (Text *) self;
+
+  this->texture = release(this->texture);
+  this->textureSize = MakeSize(0, 0);
+}
+
 /**
  * @see View::init(View *)
  */
@@ -469,6 +521,29 @@ static SDL_Size sizeThatFits(const View *self) {
   return $((Text *) self, naturalSize);
 }
 
+/**
+ * @see View::texture(const View *)
+ */
+static Texture *texture(const View *self) {
+  return ((Text *) self)->texture;
+}
+
+/**
+ * @see View::textureMemory(const View *)
+ */
+static size_t textureMemory(const View *self) {
+
+  const Text *this = (Text *) self;
+
+  if (this->texture == NULL) {
+    return 0;
+  }
+
+  const float scale = this->font->scale;
+
+  return (size_t) ceilf(this->textureSize.w * scale) * (size_t) ceilf(this->textureSize.h * scale) * 4;
+}
+
 #pragma mark - Text
 
 /**
@@ -584,11 +659,15 @@ static void initialize(Class *clazz) {
 
   ((ViewInterface *) clazz->interface)->applyStyle = applyStyle;
   ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
+  ((ViewInterface *) clazz->interface)->evictTextures = evictTextures;
   ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->render = render;
   ((ViewInterface *) clazz->interface)->renderDeviceDidReset = renderDeviceDidReset;
   ((ViewInterface *) clazz->interface)->renderDeviceWillReset = renderDeviceWillReset;
   ((ViewInterface *) clazz->interface)->sizeThatFits = sizeThatFits;
+  ((ViewInterface *) clazz->interface)->texture = texture;
+  ((ViewInterface *) clazz->interface)->textureMemory = textureMemory;
 
   ((TextInterface *) clazz->interface)->initWithText = initWithText;
   ((TextInterface *) clazz->interface)->naturalSize = naturalSize;
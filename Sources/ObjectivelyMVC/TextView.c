@@ -64,11 +64,11 @@ static void applyStyle(View *self, const Style *style) {
 
   TextView *this = (TextView *) self;
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("editable", InletTypeBool, &this->isEditable, NULL)
-  );
-
-  $(self, bind, inlets, style->attributes);
+  StyleValue *editable = $(style, valueForProperty, StylePropertyEditable);
+  if (editable) {
+    $(editable, bind, InletTypeBool, &this->isEditable, NULL);
+    self->needsLayout = true;
+  }
 }
 
 /**
@@ -22,6 +22,9 @@
  */
 
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <Objectively/JSONContext.h>
 
@@ -32,6 +35,28 @@
 
 #define _Class _Theme
 
+/**
+ * @brief The size of the stack buffer for InvalidationSet keys.
+ * @remarks Longer patterns are truncated identically when adding and looking up InvalidationSets,
+ * so that they at worst share an InvalidationSet, which invalidates conservatively.
+ */
+#define THEME_INVALIDATION_KEY_SIZE 128
+
+/**
+ * @brief Releases the InvalidationSets of `self`, so that they are recomputed on next use.
+ */
+static void releaseInvalidationSets(Theme *self) {
+
+  for (size_t i = 0; i < self->numInvalidationSets; i++) {
+    release(self->invalidationSets[i]);
+  }
+
+  free(self->invalidationSets);
+
+  self->invalidationSets = NULL;
+  self->numInvalidationSets = 0;
+}
+
 #pragma mark - Object
 
 /**
@@ -41,6 +66,8 @@ static void dealloc(Object *self) {
 
   Theme *this = (Theme *) self;
 
+  releaseInvalidationSets(this);
+  release(this->selectorFilter);
   release(this->stylesheets);
 
   super(Object, self, dealloc);
@@ -53,9 +80,20 @@ static void dealloc(Object *self) {
  * @memberof Theme
  */
 static void addStylesheet(Theme *self, Stylesheet *stylesheet) {
+
   $((Array *) self->stylesheets, addObject, stylesheet);
+
+  releaseInvalidationSets(self);
 }
 
+/**
+ * @brief A context for computeStyle.
+ */
+typedef struct {
+  const View *view;
+  const SelectorFilter *filter;
+} ComputeStyle;
+
 /**
  * @brief Reducer for computeStyle.
  */
@@ -63,12 +101,18 @@ static ident computeStyle_reduce(const ident obj, ident accumulator, ident data)
 
   const Stylesheet *stylesheet = obj;
 
-  const View *view = data;
+  const ComputeStyle *context = data;
+  const View *view = context->view;
 
   const Array *selectors = (Array *) stylesheet->selectors;
   for (size_t i = 0; i < selectors->count; i++) {
 
     Selector *selector = $(selectors, objectAtIndex, i);
+
+    if (context->filter && $(context->filter, rejectsSelector, selector)) {
+      continue;
+    }
+
     if ($(selector, matchesView, view)) {
 
       assert(selector->style);
@@ -89,7 +133,7 @@ static ident computeStyle_reduce(const ident obj, ident accumulator, ident data)
       }
 
       $((Style *) accumulator, addSelector, selector);
-      $((Style *) accumulator, addAttributes, selector->style->attributes);
+      $((Style *) accumulator, addAttributesFromStyle, selector->style);
     }
   }
 
@@ -107,7 +151,12 @@ static Style *computeStyle(const Theme *self, const View *view) {
   Style *style = $(alloc(Style), initWithAttributes, NULL);
   assert(style);
 
-  return $((Array *) self->stylesheets, reduce, computeStyle_reduce, style, (ident) view);
+  const ComputeStyle context = {
+    .view = view,
+    .filter = self->selectorFilter->view == view->superview ? self->selectorFilter : NULL
+  };
+
+  return $((Array *) self->stylesheets, reduce, computeStyle_reduce, style, (ident) &context);
 }
 
 /**
@@ -119,6 +168,9 @@ static Theme *init(Theme *self) {
   self = (Theme *) super(Object, self, init);
   if (self) {
 
+    self->selectorFilter = $(alloc(SelectorFilter), init);
+    assert(self->selectorFilter);
+
     self->stylesheets = $$(Array, arrayWithCapacity, 8);
     assert(self->stylesheets);
 
@@ -128,12 +180,160 @@ static Theme *init(Theme *self) {
   return self;
 }
 
+/**
+ * @brief Writes the InvalidationSet key for the given SimpleSelectorType and pattern to `key`.
+ * @return True if the SimpleSelectorType may have an InvalidationSet, false otherwise.
+ */
+static bool invalidationSetKey(SimpleSelectorType type, const char *pattern, char *key) {
+
+  char prefix;
+  switch (type) {
+    case SimpleSelectorTypeClass:
+      prefix = '.';
+      break;
+    case SimpleSelectorTypeId:
+      prefix = '#';
+      break;
+    case SimpleSelectorTypePseudo:
+      prefix = ':';
+      break;
+    default:
+      return false;
+  }
+
+  snprintf(key, THEME_INVALIDATION_KEY_SIZE, "%c%s", prefix, pattern);
+  return true;
+}
+
+/**
+ * @brief Adds the SimpleSelectors of `selector` to the InvalidationSets of `self`.
+ */
+static void addInvalidationSets(Theme *self, Selector *selector) {
+
+  const Array *sequences = (Array *) selector->sequences;
+  for (size_t i = 0; i < sequences->count; i++) {
+
+    const SelectorSequence *sequence = $(sequences, objectAtIndex, i);
+
+    Invalidation invalidation;
+    switch (sequence->right) {
+      case SequenceCombinatorDescendent:
+      case SequenceCombinatorChild:
+        invalidation = InvalidationDescendants;
+        break;
+      case SequenceCombinatorSibling:
+      case SequenceCombinatorAdjacent:
+        invalidation = InvalidationSiblings;
+        break;
+      default:
+        invalidation = InvalidationSelf;
+        break;
+    }
+
+    const Array *simpleSelectors = (Array *) sequence->simpleSelectors;
+    for (size_t j = 0; j < simpleSelectors->count; j++) {
+
+      const SimpleSelector *simpleSelector = $(simpleSelectors, objectAtIndex, j);
+
+      char key[THEME_INVALIDATION_KEY_SIZE];
+      if (invalidationSetKey(simpleSelector->type, simpleSelector->pattern, key)) {
+
+        const Atom atom = MVC_Atom(key);
+        if (atom >= self->numInvalidationSets) {
+
+          const size_t count = max(atom + 1, self->numInvalidationSets << 1);
+
+          self->invalidationSets = realloc(self->invalidationSets, count * sizeof(InvalidationSet *));
+          assert(self->invalidationSets);
+
+          memset(self->invalidationSets + self->numInvalidationSets, 0,
+                 (count - self->numInvalidationSets) * sizeof(InvalidationSet *));
+
+          self->numInvalidationSets = count;
+        }
+
+        InvalidationSet *set = self->invalidationSets[atom];
+        if (set == NULL) {
+          set = self->invalidationSets[atom] = $(alloc(InvalidationSet), init);
+          assert(set);
+        }
+
+        $(set, addSelector, selector, invalidation);
+      }
+    }
+  }
+}
+
+/**
+ * @fn const InvalidationSet *Theme::invalidationSet(Theme *self, SimpleSelectorType type, const char *pattern)
+ * @memberof Theme
+ */
+static const InvalidationSet *invalidationSet(Theme *self, SimpleSelectorType type, const char *pattern) {
+
+  assert(pattern);
+
+  if (self->invalidationSets == NULL) {
+
+    self->numInvalidationSets = 64;
+    self->invalidationSets = calloc(self->numInvalidationSets, sizeof(InvalidationSet *));
+    assert(self->invalidationSets);
+
+    const Array *stylesheets = (Array *) self->stylesheets;
+    for (size_t i = 0; i < stylesheets->count; i++) {
+
+      const Stylesheet *stylesheet = $(stylesheets, objectAtIndex, i);
+
+      const Array *selectors = (Array *) stylesheet->selectors;
+      for (size_t j = 0; j < selectors->count; j++) {
+        addInvalidationSets(self, $(selectors, objectAtIndex, j));
+      }
+    }
+  }
+
+  char key[THEME_INVALIDATION_KEY_SIZE];
+  if (invalidationSetKey(type, pattern, key)) {
+    const Atom atom = MVC_AtomForName(key);
+    if (atom && atom < self->numInvalidationSets) {
+      return self->invalidationSets[atom];
+    }
+  }
+
+  return NULL;
+}
+
 /**
  * @fn void Theme::removeStylesheet(Theme *self, Stylesheet *stylesheet)
  * @memberof Theme
  */
 static void removeStylesheet(Theme *self, Stylesheet *stylesheet) {
+
   $((Array *) self->stylesheets, removeObject, stylesheet);
+
+  releaseInvalidationSets(self);
+}
+
+/**
+ * @fn bool Theme::replaceStylesheet(Theme *self, Stylesheet *stylesheet, Stylesheet *replacement)
+ * @memberof Theme
+ */
+static bool replaceStylesheet(Theme *self, Stylesheet *stylesheet, Stylesheet *replacement) {
+
+  assert(stylesheet);
+  assert(replacement);
+
+  Array *stylesheets = (Array *) self->stylesheets;
+  for (size_t i = 0; i < stylesheets->count; i++) {
+    if (stylesheets->elements[i] == stylesheet) {
+
+      $(stylesheets, insertObjectAtIndex, replacement, i);
+      $(stylesheets, removeObjectAtIndex, i + 1);
+
+      releaseInvalidationSets(self);
+      return true;
+    }
+  }
+
+  return false;
 }
 
 /**
@@ -164,7 +364,9 @@ static void initialize(Class *clazz) {
   ((ThemeInterface *) clazz->interface)->addStylesheet = addStylesheet;
   ((ThemeInterface *) clazz->interface)->computeStyle = computeStyle;
   ((ThemeInterface *) clazz->interface)->init = init;
+  ((ThemeInterface *) clazz->interface)->invalidationSet = invalidationSet;
   ((ThemeInterface *) clazz->interface)->removeStylesheet = removeStylesheet;
+  ((ThemeInterface *) clazz->interface)->replaceStylesheet = replaceStylesheet;
   ((ThemeInterface *) clazz->interface)->theme = theme;
 }
 
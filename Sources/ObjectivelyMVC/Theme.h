@@ -24,7 +24,10 @@
 #pragma once
 
 #include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
 
+#include <ObjectivelyMVC/InvalidationSet.h>
+#include <ObjectivelyMVC/SelectorFilter.h>
 #include <ObjectivelyMVC/Stylesheet.h>
 
 /**
@@ -61,6 +64,25 @@ struct Theme {
    */
   ThemeInterface *interface;
 
+  /**
+   * @brief The InvalidationSets, indexed by the Atom of their SimpleSelector key.
+   * @remarks These are computed lazily from the Stylesheets, and discarded when they change.
+   * Slots for which no Selector depends on the SimpleSelector are `NULL`.
+   * @private
+   */
+  InvalidationSet **invalidationSets;
+
+  /**
+   * @brief The length of `invalidationSets`.
+   * @private
+   */
+  size_t numInvalidationSets;
+
+  /**
+   * @brief The SelectorFilter, maintained by View::applyThemeIfNeeded.
+   */
+  SelectorFilter *selectorFilter;
+
   /**
    * @brief The Stylesheets, in order of priority.
    */
@@ -104,6 +126,17 @@ struct ThemeInterface {
    */
   Theme *(*init)(Theme *self);
 
+  /**
+   * @fn const InvalidationSet *Theme::invalidationSet(Theme *self, SimpleSelectorType type, const char *pattern)
+   * @param self The Theme.
+   * @param type The SimpleSelectorType, one of class, id or pseudo-class.
+   * @param pattern The pattern.
+   * @return The InvalidationSet for the given SimpleSelector, or `NULL` if no Selector in this
+   * Theme depends on it.
+   * @memberof Theme
+   */
+  const InvalidationSet *(*invalidationSet)(Theme *self, SimpleSelectorType type, const char *pattern);
+
   /**
    * @fn void Theme::removeStylesheet(Theme *self, Stylesheet *stylesheet)
    * @brief Removes the given Stylesheet from this Theme.
@@ -113,6 +146,17 @@ struct ThemeInterface {
    */
   void (*removeStylesheet)(Theme *self, Stylesheet *stylesheet);
 
+  /**
+   * @fn bool Theme::replaceStylesheet(Theme *self, Stylesheet *stylesheet, Stylesheet *replacement)
+   * @brief Replaces the given Stylesheet with `replacement`, retaining its priority.
+   * @param self The Theme.
+   * @param stylesheet The Stylesheet.
+   * @param replacement The replacement Stylesheet.
+   * @return True if `stylesheet` was replaced, false if it does not belong to this Theme.
+   * @memberof Theme
+   */
+  bool (*replaceStylesheet)(Theme *self, Stylesheet *stylesheet, Stylesheet *replacement);
+
   /**
    * @static
    * @fn Theme *Theme::theme(SDL_Window *window)
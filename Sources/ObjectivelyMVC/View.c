@@ -30,6 +30,7 @@
 #include "Log.h"
 #include "View.h"
 #include "ViewController.h"
+#include "ViewTemplate.h"
 #include "WindowController.h"
 #include "Window.h"
 
@@ -103,7 +104,8 @@ static void dealloc(Object *self) {
 
   free(this->identifier);
 
-  release(this->classNames);
+  free(this->classNames);
+
   release(this->computedStyle);
   release(this->style);
   release(this->stylesheet);
@@ -123,7 +125,7 @@ static String *description(const Object *self) {
   View *this = (View *) self;
   const SDL_Rect bounds = $(this, bounds);
 
-  String *classNames = $((Object *) this->classNames, description);
+  String *classNames = MVC_AtomsDescription(this->classNames, this->numClassNames);
   String *description = str("%s@%p %s [%d, %d, %d, %d]",
                 this->identifier ?: classnameof(self),
                 self,
@@ -152,6 +154,35 @@ static bool acceptsTouchResponder(const View *self) {
   return false;
 }
 
+/**
+ * @return The index at which the given class name Atom is, or would be, stored in `classNames`.
+ */
+static size_t indexOfClassName(const View *self, Atom atom) {
+
+  size_t lo = 0, hi = self->numClassNames;
+
+  while (lo < hi) {
+    const size_t mid = (lo + hi) >> 1;
+    if (self->classNames[mid] < atom) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+/**
+ * @return True if this View has the given class name Atom, false otherwise.
+ */
+static bool hasClassAtom(const View *self, Atom atom) {
+
+  const size_t index = indexOfClassName(self, atom);
+
+  return index < self->numClassNames && self->classNames[index] == atom;
+}
+
 /**
  * @fn void View::addClassName(View *self, const char *className)
  * @memberof View
@@ -160,13 +191,33 @@ static void addClassName(View *self, const char *className) {
 
   if (className) {
 
-    String *string = $$(String, stringWithCharacters, className);
-    assert(string);
+    const Atom atom = MVC_Atom(className);
 
-    $(self->classNames, addObject, string);
-    release(string);
+    const size_t index = indexOfClassName(self, atom);
+    if (index < self->numClassNames && self->classNames[index] == atom) {
+      return;
+    }
+
+    self->classNames = realloc(self->classNames, (self->numClassNames + 1) * sizeof(Atom));
+    assert(self->classNames);
+
+    memmove(self->classNames + index + 1, self->classNames + index, (self->numClassNames - index) * sizeof(Atom));
+
+    self->classNames[index] = atom;
+    self->numClassNames++;
+
+    $(self, invalidateStyleForSimpleSelector, SimpleSelectorTypeClass, className);
+  }
+}
+
+/**
+ * @brief Updates the cached subviewIndex of the subviews of `view`, starting at `index`.
+ */
+static void reindexSubviews(View *view, size_t index) {
 
-    $(self, invalidateStyle);
+  const Array *subviews = (Array *) view->subviews;
+  for (size_t i = index; i < subviews->count; i++) {
+    ((View *) subviews->elements[i])->subviewIndex = i;
   }
 }
 
@@ -191,26 +242,27 @@ static void addSubviewRelativeTo(View *self, View *subview, View *other, ViewPos
 
   $(subview, removeFromSuperview);
 
+  size_t index = self->subviews->count;
+
   if (other && other->superview == self) {
 
-    const Array *subviews = (Array *) self->subviews;
-    const ssize_t index = $(subviews, indexOfObject, other);
+    index = other->subviewIndex;
 
     if (position == ViewPositionAfter) {
-      if (index == (ssize_t) (subviews->count - 1)) {
-        $(self->subviews, addObject, subview);
-      } else {
-        $(self->subviews, insertObjectAtIndex, subview, index + 1);
-      }
-    } else {
-      $(self->subviews, insertObjectAtIndex, subview, index);
+      index++;
     }
-  } else {
+  }
+
+  if (index == self->subviews->count) {
     $(self->subviews, addObject, subview);
+  } else {
+    $(self->subviews, insertObjectAtIndex, subview, index);
   }
 
   release(subview);
 
+  reindexSubviews(self, index);
+
   subview->superview = self;
 
   $(subview, moveToWindow, self->window);
@@ -249,33 +301,86 @@ static void applyStyle(View *self, const Style *style) {
 
   assert(style);
 
-  const Inlet inlets[] = MakeInlets(
-    MakeInlet("alignment", InletTypeEnum, &self->alignment, (ident) ViewAlignmentNames),
-    MakeInlet("autoresizing-mask", InletTypeEnum, &self->autoresizingMask, (ident) ViewAutoresizingNames),
-    MakeInlet("background-color", InletTypeColor, &self->backgroundColor, NULL),
-    MakeInlet("border-color", InletTypeColor, &self->borderColor, NULL),
-    MakeInlet("border-width", InletTypeInteger, &self->borderWidth, NULL),
-    MakeInlet("clips-subviews", InletTypeBool, &self->clipsSubviews, NULL),
-    MakeInlet("frame", InletTypeRectangle, &self->frame, NULL),
-    MakeInlet("hidden", InletTypeBool, &self->hidden, NULL),
-    MakeInlet("height", InletTypeInteger, &self->frame.h, NULL),
-    MakeInlet("left", InletTypeInteger, &self->frame.x, NULL),
-    MakeInlet("max-height", InletTypeInteger, &self->maxSize.h, NULL),
-    MakeInlet("max-size", InletTypeSize, &self->maxSize, NULL),
-    MakeInlet("max-width", InletTypeInteger, &self->maxSize.w, NULL),
-    MakeInlet("min-height", InletTypeInteger, &self->minSize.h, NULL),
-    MakeInlet("min-size", InletTypeSize, &self->minSize, NULL),
-    MakeInlet("min-width", InletTypeInteger, &self->minSize.w, NULL),
-    MakeInlet("padding", InletTypeRectangle, &self->padding, NULL),
-    MakeInlet("padding-top", InletTypeInteger, &self->padding.top, NULL),
-    MakeInlet("padding-right", InletTypeInteger, &self->padding.right, NULL),
-    MakeInlet("padding-bottom", InletTypeInteger, &self->padding.bottom, NULL),
-    MakeInlet("padding-left", InletTypeInteger, &self->padding.left, NULL),
-    MakeInlet("top", InletTypeInteger, &self->frame.y, NULL),
-    MakeInlet("width", InletTypeInteger, &self->frame.w, NULL)
-  );
+  for (size_t i = 0; i < style->numValues; i++) {
+
+    StyleValue *value = style->values[i];
 
-  $(self, bind, inlets, style->attributes);
+    switch (value->property) {
+      case StylePropertyAlignment:
+        $(value, bind, InletTypeEnum, &self->alignment, (ident) ViewAlignmentNames);
+        break;
+      case StylePropertyAutoresizingMask:
+        $(value, bind, InletTypeEnum, &self->autoresizingMask, (ident) ViewAutoresizingNames);
+        break;
+      case StylePropertyBackgroundColor:
+        $(value, bind, InletTypeColor, &self->backgroundColor, NULL);
+        break;
+      case StylePropertyBorderColor:
+        $(value, bind, InletTypeColor, &self->borderColor, NULL);
+        break;
+      case StylePropertyBorderWidth:
+        $(value, bind, InletTypeInteger, &self->borderWidth, NULL);
+        break;
+      case StylePropertyClipsSubviews:
+        $(value, bind, InletTypeBool, &self->clipsSubviews, NULL);
+        break;
+      case StylePropertyFrame:
+        $(value, bind, InletTypeRectangle, &self->frame, NULL);
+        break;
+      case StylePropertyHidden:
+        $(value, bind, InletTypeBool, &self->hidden, NULL);
+        break;
+      case StylePropertyHeight:
+        $(value, bind, InletTypeInteger, &self->frame.h, NULL);
+        break;
+      case StylePropertyLeft:
+        $(value, bind, InletTypeInteger, &self->frame.x, NULL);
+        break;
+      case StylePropertyMaxSize:
+        $(value, bind, InletTypeSize, &self->maxSize, NULL);
+        break;
+      case StylePropertyMaxHeight:
+        $(value, bind, InletTypeInteger, &self->maxSize.h, NULL);
+        break;
+      case StylePropertyMaxWidth:
+        $(value, bind, InletTypeInteger, &self->maxSize.w, NULL);
+        break;
+      case StylePropertyMinSize:
+        $(value, bind, InletTypeSize, &self->minSize, NULL);
+        break;
+      case StylePropertyMinHeight:
+        $(value, bind, InletTypeInteger, &self->minSize.h, NULL);
+        break;
+      case StylePropertyMinWidth:
+        $(value, bind, InletTypeInteger, &self->minSize.w, NULL);
+        break;
+      case StylePropertyPadding:
+        $(value, bind, InletTypeRectangle, &self->padding, NULL);
+        break;
+      case StylePropertyPaddingBottom:
+        $(value, bind, InletTypeInteger, &self->padding.bottom, NULL);
+        break;
+      case StylePropertyPaddingLeft:
+        $(value, bind, InletTypeInteger, &self->padding.left, NULL);
+        break;
+      case StylePropertyPaddingRight:
+        $(value, bind, InletTypeInteger, &self->padding.right, NULL);
+        break;
+      case StylePropertyPaddingTop:
+        $(value, bind, InletTypeInteger, &self->padding.top, NULL);
+        break;
+      case StylePropertyTop:
+        $(value, bind, InletTypeInteger, &self->frame.y, NULL);
+        break;
+      case StylePropertyWidth:
+        $(value, bind, InletTypeInteger, &self->frame.w, NULL);
+        break;
+      default:
+        continue;
+    }
+
+    self->needsLayout = true;
+  }
 }
 
 /**
@@ -294,7 +399,7 @@ static void applyTheme(View *self, const Theme *theme) {
     release(self->computedStyle);
     self->computedStyle = retain(computedStyle);
 
-    $(self->computedStyle, addAttributes, self->style->attributes);
+    $(self->computedStyle, addAttributesFromStyle, self->style);
     $(self, applyStyle, self->computedStyle);
   }
 
@@ -318,8 +423,19 @@ static void applyThemeIfNeeded(View *self, const Theme *theme) {
 
   assert(theme);
 
+  SelectorFilter *filter = theme->selectorFilter;
+
+  const bool isRoot = filter->view != self->superview;
+  if (isRoot) {
+    $(filter, resetWithView, self->superview);
+  }
+
+  $(filter, addView, self);
+
   $(self, enumerateSubviews, _applyThemeIfNeeded, (ident) theme);
 
+  $(filter, removeView);
+
   if (self->needsApplyTheme) {
 
     $(self, clearWarnings, WarningTypeStyle);
@@ -328,6 +444,10 @@ static void applyThemeIfNeeded(View *self, const Theme *theme) {
 
     self->needsApplyTheme = false;
   }
+
+  if (isRoot) {
+    $(filter, resetWithView, NULL);
+  }
 }
 
 /**
@@ -365,6 +485,16 @@ static void awakeWithCharacters(View *self, const char *chars) {
  */
 static void awakeWithData(View *self, const Data *data) {
 
+  if (MVC_IsCompiledViewTemplate(data)) {
+
+    ViewTemplate *viewTemplate = $$(ViewTemplate, viewTemplateWithData, data);
+    if (viewTemplate) {
+      $(self, awakeWithDictionary, viewTemplate->dictionary);
+      release(viewTemplate);
+    }
+    return;
+  }
+
   JSONContext *ctx = $(alloc(JSONContext), init);
   Dictionary *dictionary = $(ctx, objectFromData, data, 0);
 
@@ -396,6 +526,83 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
   $(self, bind, inlets, dictionary);
 }
 
+/**
+ * @fn void View::awakeWithPrototype(View *self, const View *prototype)
+ * @memberof View
+ */
+static void awakeWithPrototype(View *self, const View *prototype) {
+
+  assert(prototype);
+  assert(self->object.clazz == prototype->object.clazz);
+
+  self->alignment = prototype->alignment;
+  self->autoresizingMask = prototype->autoresizingMask;
+  self->backgroundColor = prototype->backgroundColor;
+  self->borderColor = prototype->borderColor;
+  self->borderWidth = prototype->borderWidth;
+  self->clipsSubviews = prototype->clipsSubviews;
+  self->frame = prototype->frame;
+  self->hidden = prototype->hidden;
+  self->maxSize = prototype->maxSize;
+  self->minSize = prototype->minSize;
+  self->padding = prototype->padding;
+
+  free(self->identifier);
+  self->identifier = prototype->identifier ? strdup(prototype->identifier) : NULL;
+
+  free(self->classNames);
+  self->classNames = NULL;
+  self->numClassNames = prototype->numClassNames;
+
+  if (self->numClassNames) {
+    self->classNames = malloc(self->numClassNames * sizeof(Atom));
+    assert(self->classNames);
+
+    memcpy(self->classNames, prototype->classNames, self->numClassNames * sizeof(Atom));
+  }
+
+  release(self->computedStyle);
+  self->computedStyle = retain(prototype->computedStyle);
+
+  $(self->style, removeAllAttributes);
+  $(self->style, addAttributesFromStyle, prototype->style);
+
+  release(self->stylesheet);
+  self->stylesheet = prototype->stylesheet ? retain(prototype->stylesheet) : NULL;
+
+  self->needsApplyTheme = prototype->needsApplyTheme;
+  self->needsLayout = true;
+
+  for (size_t i = 0; i < prototype->subviews->count; i++) {
+
+    const View *subview = prototype->subviews->elements[i];
+
+    if (i < self->subviews->count) {
+      View *that = self->subviews->elements[i];
+      if (that->object.clazz == subview->object.clazz) {
+        $(that, awakeWithPrototype, subview);
+        continue;
+      }
+      $(that, removeFromSuperview);
+    }
+
+    View *copy = $(subview, clone);
+    assert(copy);
+
+    if (i < self->subviews->count) {
+      $(self, addSubviewRelativeTo, copy, self->subviews->elements[i], ViewPositionBefore);
+    } else {
+      $(self, addSubview, copy);
+    }
+
+    release(copy);
+  }
+
+  while (self->subviews->count > prototype->subviews->count) {
+    $((View *) $(self->subviews, lastObject), removeFromSuperview);
+  }
+}
+
 /**
  * @fn void View::awakeWithResource(View *self, const Resource *resource)
  * @memberof View
@@ -520,6 +727,27 @@ static void bringSubviewToFront(View *self, View *subview) {
   }
 }
 
+/**
+ * @fn Set *View::classNameSet(const View *self)
+ * @memberof View
+ */
+static Set *classNameSet(const View *self) {
+
+  MutableSet *set = $$(MutableSet, setWithCapacity, self->numClassNames);
+  assert(set);
+
+  for (size_t i = 0; i < self->numClassNames; i++) {
+
+    String *string = $$(String, stringWithCharacters, MVC_AtomName(self->classNames[i]));
+    assert(string);
+
+    $(set, addObject, string);
+    release(string);
+  }
+
+  return (Set *) set;
+}
+
 /**
  * @brief Filter Predicate for clearWarnings.
  */
@@ -539,6 +767,20 @@ static void clearWarnings(const View *self, WarningType type) {
   $(self->warnings, filter, clearWarnings_predicate, &type);
 }
 
+/**
+ * @fn View *View::clone(const View *self)
+ * @memberof View
+ */
+static View *clone(const View *self) {
+
+  View *view = $((View *) _alloc(self->object.clazz), init);
+  assert(view);
+
+  $(view, awakeWithPrototype, self);
+
+  return view;
+}
+
 /**
  * @fn SDL_Rect View::clippingFrame(const View *self)
  * @memberof View
@@ -582,6 +824,28 @@ static bool containsPoint(const View *self, const SDL_Point *point) {
   return (bool) SDL_PointInRect(point, &frame);
 }
 
+/**
+ * @fn View *View::counterpart(const View *self, const View *prototype, const View *descendant)
+ * @memberof View
+ */
+static View *counterpart(const View *self, const View *prototype, const View *descendant) {
+
+  if (descendant == NULL) {
+    return NULL;
+  }
+
+  if (descendant == prototype) {
+    return (View *) self;
+  }
+
+  const View *superview = $(self, counterpart, prototype, descendant->superview);
+  if (superview && descendant->subviewIndex < superview->subviews->count) {
+    return superview->subviews->elements[descendant->subviewIndex];
+  }
+
+  return NULL;
+}
+
 /**
  * @fn int View::depth(const View *self)
  * @memberof View
@@ -876,10 +1140,11 @@ static void enumerateVisible(View *self, ViewEnumerator enumerator, ident data)
 }
 
 /**
- * @brief Predicate for hasClassName.
+ * @fn void View::evictTextures(View *self)
+ * @memberof View
  */
-static bool hasClassName_predicate(const ident obj, ident data) {
-  return strcmp(((String *) obj)->chars, (const char *) data) == 0;
+static void evictTextures(View *self) {
+
 }
 
 /**
@@ -888,8 +1153,9 @@ static bool hasClassName_predicate(const ident obj, ident data) {
  */
 static bool hasClassName(const View *self, const char *className) {
 
-  if (className) {
-    return $((Set *) self->classNames, containsObjectMatching, hasClassName_predicate, (ident) className);
+  const Atom atom = MVC_AtomForName(className);
+  if (atom) {
+    return hasClassAtom(self, atom);
   }
 
   return false;
@@ -984,9 +1250,6 @@ static View *initWithFrame(View *self, const SDL_Rect *frame) {
       self->frame = *frame;
     }
 
-    self->classNames = $$(Set, setWithCapacity, 0);
-    assert(self->classNames);
-
     self->computedStyle = $(alloc(Style), initWithAttributes, NULL);
     assert(self->computedStyle);
 
@@ -1023,6 +1286,55 @@ static void invalidateStyle(View *self) {
   $(self, enumerate, invalidateStyle_enumerate, NULL);
 }
 
+/**
+ * @fn void View::invalidateStyleForSimpleSelector(View *self, SimpleSelectorType type, const char *pattern)
+ * @memberof View
+ */
+static void invalidateStyleForSimpleSelector(View *self, SimpleSelectorType type, const char *pattern) {
+
+  assert(pattern);
+
+  if (self->window) {
+    Theme *theme = $$(Theme, theme, self->window);
+    if (theme) {
+      const InvalidationSet *set = $(theme, invalidationSet, type, pattern);
+      if (set) {
+        $(set, invalidateView, self);
+      }
+      return;
+    }
+  }
+
+  $(self, invalidateStyle);
+}
+
+/**
+ * @brief ViewEnumerator for invalidateStyleForSelectors.
+ */
+static void invalidateStyleForSelectors_enumerate(View *view, ident data) {
+
+  const Array *selectors = data;
+  for (size_t i = 0; i < selectors->count; i++) {
+    if ($((Selector *) selectors->elements[i], matchesView, view)) {
+      view->needsApplyTheme = true;
+      break;
+    }
+  }
+}
+
+/**
+ * @fn void View::invalidateStyleForSelectors(View *self, const Array *selectors)
+ * @memberof View
+ */
+static void invalidateStyleForSelectors(View *self, const Array *selectors) {
+
+  assert(selectors);
+
+  if (selectors->count) {
+    $(self, enumerate, invalidateStyleForSelectors_enumerate, (ident) selectors);
+  }
+}
+
 /**
  * @fn bool View::isContainer(const View *self)
  * @memberof View
@@ -1191,7 +1503,7 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
       return true;
 
     case SimpleSelectorTypeType: {
-      const Class *clazz = classForName(pattern);
+      const Class *clazz = simpleSelector->clazz ?: classForName(pattern);
       if (clazz) {
         return $((Object *) self, isKindOfClass, clazz);
       }
@@ -1199,7 +1511,7 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
       break;
 
     case SimpleSelectorTypeClass:
-      return $(self, hasClassName, pattern);
+      return hasClassAtom(self, simpleSelector->atom);
 
     case SimpleSelectorTypeId:
       if (self->identifier) {
@@ -1209,27 +1521,23 @@ static bool matchesSelector(const View *self, const SimpleSelector *simpleSelect
       }
 
     case SimpleSelectorTypePseudo:
-      if (strcmp("first-child", pattern) == 0) {
-        if (self->superview) {
-          return $((Array *) self->superview->subviews, firstObject) == self;
+      switch (simpleSelector->pseudoClass) {
+        case PseudoClassFirstChild:
+          return self->superview && self->subviewIndex == 0;
+        case PseudoClassLastChild:
+          return self->superview && self->subviewIndex == self->superview->subviews->count - 1;
+        case PseudoClassNthChildEven:
+          return self->superview && (self->subviewIndex & 1) == 0;
+        case PseudoClassNthChildOdd:
+          return self->superview && (self->subviewIndex & 1) == 1;
+        case PseudoClassHover: {
+          float mx, my;
+          SDL_GetMouseState(&mx, &my);
+          SDL_Point point = MakePoint(mx, my);
+          return $(self, containsPoint, &point);
         }
-      } else if (strcmp("last-child", pattern) == 0) {
-        if (self->superview) {
-          return $((Array *) self->superview->subviews, lastObject) == self;
-        }
-      } else if (strcmp("nth-child(even)", pattern) == 0) {
-        if (self->superview) {
-          return ($((Array *) self->superview->subviews, indexOfObject, (ident) self) & 1) == 0;
-        }
-      }  else if (strcmp("nth-child(odd)", pattern) == 0) {
-        if (self->superview) {
-          return $((Array *) self->superview->subviews, indexOfObject, (ident) self) & 1;
-        }
-      } else if (strcmp("hover", pattern) == 0) {
-        float mx, my;
-        SDL_GetMouseState(&mx, &my);
-        SDL_Point point = MakePoint(mx, my);
-        return $(self, containsPoint, &point);
+        default:
+          break;
       }
       break;
   }
@@ -1270,19 +1578,15 @@ static String *path(const View *self) {
   const View *view = self;
   while (view) {
 
-    Array *classNames = $((Set *) view->classNames, allObjects);
-
     String *part;
     if (view->identifier) {
       part = str("#%s", view->identifier);
-    } else if (classNames->count) {
-      part = str(".%s", ((String *) $(classNames, firstObject))->chars);
+    } else if (view->numClassNames) {
+      part = str(".%s", MVC_AtomName(view->classNames[0]));
     } else {
       part = str("%s", classnameof(view));
     }
 
-    release(classNames);
-
     $(parts, insertObjectAtIndex, part, 0);
     release(part);
 
@@ -1306,9 +1610,17 @@ static String *path(const View *self) {
  */
 static void removeAllClassNames(View *self) {
 
-  $(self->classNames, removeAllObjects);
+  Atom *classNames = self->classNames;
+  const size_t numClassNames = self->numClassNames;
 
-  $(self, invalidateStyle);
+  self->classNames = NULL;
+  self->numClassNames = 0;
+
+  for (size_t i = 0; i < numClassNames; i++) {
+    $(self, invalidateStyleForSimpleSelector, SimpleSelectorTypeClass, MVC_AtomName(classNames[i]));
+  }
+
+  free(classNames);
 }
 
 /**
@@ -1332,14 +1644,23 @@ static void removeAllSubviews(View *self) {
  */
 static void removeClassName(View *self, const char *className) {
 
-  if (className) {
-    String *string = $$(String, stringWithCharacters, className);
-    assert(string);
+  const Atom atom = MVC_AtomForName(className);
+  if (atom) {
 
-    $(self->classNames, removeObject, string);
-    release(string);
+    const size_t index = indexOfClassName(self, atom);
+    if (index == self->numClassNames || self->classNames[index] != atom) {
+      return;
+    }
+
+    self->numClassNames--;
+    memmove(self->classNames + index, self->classNames + index + 1, (self->numClassNames - index) * sizeof(Atom));
+
+    if (self->numClassNames == 0) {
+      free(self->classNames);
+      self->classNames = NULL;
+    }
 
-    $(self, invalidateStyle);
+    $(self, invalidateStyleForSimpleSelector, SimpleSelectorTypeClass, className);
   }
 }
 
@@ -1368,7 +1689,17 @@ static void removeSubview(View *self, View *subview) {
 
     $(subview, moveToWindow, NULL);
 
-    $(self->subviews, removeObject, subview);
+    const size_t index = subview->subviewIndex;
+    subview->subviewIndex = 0;
+
+    const Array *subviews = (Array *) self->subviews;
+    if (index < subviews->count && subviews->elements[index] == subview) {
+      $(self->subviews, removeObjectAtIndex, index);
+    } else {
+      $(self->subviews, removeObject, subview);
+    }
+
+    reindexSubviews(self, index);
 
     self->needsLayout = true;
   }
@@ -1783,6 +2114,22 @@ static View *subviewWithIdentifier(const View *self, const char *identifier) {
   return NULL;
 }
 
+/**
+ * @fn Texture *View::texture(const View *self)
+ * @memberof View
+ */
+static Texture *texture(const View *self) {
+  return NULL;
+}
+
+/**
+ * @fn size_t View::textureMemory(const View *self)
+ * @memberof View
+ */
+static size_t textureMemory(const View *self) {
+  return 0;
+}
+
 /**
  * @brief ViewEnumerator for updateBindings recursion.
  */
@@ -1832,6 +2179,16 @@ static View *viewWithCharacters(const char *chars, Outlet *outlets) {
  */
 static View *viewWithData(const Data *data, Outlet *outlets) {
 
+  if (MVC_IsCompiledViewTemplate(data)) {
+
+    ViewTemplate *viewTemplate = $$(ViewTemplate, viewTemplateWithData, data);
+
+    View *view = viewTemplate ? $(viewTemplate, instantiate, outlets) : NULL;
+
+    release(viewTemplate);
+    return view;
+  }
+
   JSONContext *ctx = $(alloc(JSONContext), init);
   Dictionary *dictionary = $(ctx, objectFromData, data, 0);
 
@@ -1964,6 +2321,7 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->awakeWithCharacters = awakeWithCharacters;
   ((ViewInterface *) clazz->interface)->awakeWithData = awakeWithData;
   ((ViewInterface *) clazz->interface)->awakeWithDictionary = awakeWithDictionary;
+  ((ViewInterface *) clazz->interface)->awakeWithPrototype = awakeWithPrototype;
   ((ViewInterface *) clazz->interface)->awakeWithResource = awakeWithResource;
   ((ViewInterface *) clazz->interface)->awakeWithResourceName = awakeWithResourceName;
   ((ViewInterface *) clazz->interface)->becomeKeyResponder = becomeKeyResponder;
@@ -1971,9 +2329,12 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->bind = _bind;
   ((ViewInterface *) clazz->interface)->bounds = bounds;
   ((ViewInterface *) clazz->interface)->bringSubviewToFront = bringSubviewToFront;
+  ((ViewInterface *) clazz->interface)->classNameSet = classNameSet;
   ((ViewInterface *) clazz->interface)->clearWarnings = clearWarnings;
+  ((ViewInterface *) clazz->interface)->clone = clone;
   ((ViewInterface *) clazz->interface)->clippingFrame = clippingFrame;
   ((ViewInterface *) clazz->interface)->containsPoint = containsPoint;
+  ((ViewInterface *) clazz->interface)->counterpart = counterpart;
   ((ViewInterface *) clazz->interface)->depth = depth;
   ((ViewInterface *) clazz->interface)->descendantWithIdentifier = descendantWithIdentifier;
   ((ViewInterface *) clazz->interface)->detachStylesheet = detachStylesheet;
@@ -1990,12 +2351,15 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->enumerateSubviews = enumerateSubviews;
   ((ViewInterface *) clazz->interface)->enumerateSuperview = enumerateSuperview;
   ((ViewInterface *) clazz->interface)->enumerateVisible = enumerateVisible;
+  ((ViewInterface *) clazz->interface)->evictTextures = evictTextures;
   ((ViewInterface *) clazz->interface)->hasClassName = hasClassName;
   ((ViewInterface *) clazz->interface)->hasOverflow = hasOverflow;
   ((ViewInterface *) clazz->interface)->hitTest = hitTest;
   ((ViewInterface *) clazz->interface)->init = init;
   ((ViewInterface *) clazz->interface)->initWithFrame = initWithFrame;
   ((ViewInterface *) clazz->interface)->invalidateStyle = invalidateStyle;
+  ((ViewInterface *) clazz->interface)->invalidateStyleForSelectors = invalidateStyleForSelectors;
+  ((ViewInterface *) clazz->interface)->invalidateStyleForSimpleSelector = invalidateStyleForSimpleSelector;
   ((ViewInterface *) clazz->interface)->isContainer = isContainer;
   ((ViewInterface *) clazz->interface)->isDescendantOfView = isDescendantOfView;
   ((ViewInterface *) clazz->interface)->isKeyResponder = isKeyResponder;
@@ -2031,6 +2395,8 @@ static void initialize(Class *clazz) {
   ((ViewInterface *) clazz->interface)->sizeToFill = sizeToFill;
   ((ViewInterface *) clazz->interface)->sizeToFit = sizeToFit;
   ((ViewInterface *) clazz->interface)->subviewWithIdentifier = subviewWithIdentifier;
+  ((ViewInterface *) clazz->interface)->texture = texture;
+  ((ViewInterface *) clazz->interface)->textureMemory = textureMemory;
   ((ViewInterface *) clazz->interface)->updateBindings = updateBindings;
   ((ViewInterface *) clazz->interface)->viewport = viewport;
   ((ViewInterface *) clazz->interface)->viewWithCharacters = viewWithCharacters;
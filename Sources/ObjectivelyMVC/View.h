@@ -30,6 +30,7 @@
 #include <Objectively/Set.h>
 #include <Objectively/Resource.h>
 
+#include <ObjectivelyMVC/Atom.h>
 #include <ObjectivelyMVC/Colors.h>
 #include <ObjectivelyMVC/Renderer.h>
 #include <ObjectivelyMVC/Theme.h>
@@ -170,10 +171,18 @@ struct View {
   int borderWidth;
 
   /**
-   * @brief The class names.
+   * @brief The class names, as a sorted array of Atoms.
+   * @remarks This is allocated lazily, as most Views have few or no class names.
+   * @remarks This was formerly a `Set` of `String`s. Use View::classNameSet for that form, or
+   * View::hasClassName to test membership.
    * @see Style
    */
-  Set *classNames;
+  Atom *classNames;
+
+  /**
+   * @brief The count of `classNames`.
+   */
+  size_t numClassNames;
 
   /**
    * @brief If true, subviews will be clipped to this View's frame.
@@ -201,6 +210,13 @@ struct View {
    */
   char *identifier;
 
+  /**
+   * @brief The Renderer frame in which this View was last drawn.
+   * @remarks Renderer uses this to evict the Textures of Views that are no longer drawn.
+   * @see Renderer::manageTextures(Renderer *, View *)
+   */
+  Uint64 lastDrawn;
+
   /**
    * @brief The maximum size this View may be resized to during layout.
    */
@@ -247,6 +263,13 @@ struct View {
    */
   Stylesheet *stylesheet;
 
+  /**
+   * @brief The index of this View within its superview's subviews.
+   * @remarks This is maintained as subviews are added and removed, so that structural
+   * pseudo-classes may be matched in constant time.
+   */
+  size_t subviewIndex;
+
   /**
    * @brief The immediate subviews.
    */
@@ -392,7 +415,8 @@ struct ViewInterface {
    * @fn void View::awakeWithData(View *self, const Data *data)
    * @brief Wakes this View with the specified JSON Data.
    * @param self The View.
-   * @param data The JSON Data containing properties describing this View.
+   * @param data The JSON Data containing properties describing this View, or a compiled
+   * ViewTemplate.
    * @remarks This is a convenience method for View::awakeWithDictionary.
    * @memberof View
    */
@@ -409,6 +433,18 @@ struct ViewInterface {
    */
   void (*awakeWithDictionary)(View *self, const Dictionary *dictionary);
 
+  /**
+   * @fn void View::awakeWithPrototype(View *self, const View *prototype)
+   * @brief Wakes this View with the attributes of the specified prototype.
+   * @param self The View.
+   * @param prototype A View of the same Class as this View.
+   * @remarks This method is invoked by View::clone. Subclasses with additional state should
+   * override this method to copy that state from `prototype`, sharing immutable resources
+   * such as Fonts, Images and Textures rather than recreating them.
+   * @memberof View
+   */
+  void (*awakeWithPrototype)(View *self, const View *prototype);
+
   /**
    * @fn void View::awakeWithResource(View *self, const Resource *resource)
    * @brief Wakes this View with the specified Resource.
@@ -474,6 +510,14 @@ struct ViewInterface {
    */
   void (*bringSubviewToFront)(View *self, View *subview);
 
+  /**
+   * @fn Set *View::classNameSet(const View *self)
+   * @param self The View.
+   * @return A new Set of this View's class names, as Strings.
+   * @memberof View
+   */
+  Set *(*classNameSet)(const View *self);
+
   /**
    * @fn void View::clearWarnings(const View *self, WarningType level)
    * @brief Clears this View's Warnings matching the given level.
@@ -483,6 +527,17 @@ struct ViewInterface {
    */
   void (*clearWarnings)(const View *self, WarningType level);
 
+  /**
+   * @fn View *View::clone(const View *self)
+   * @brief Creates a deep copy of this View and its subviews.
+   * @param self The View.
+   * @return The clone, which shares this View's computed Style, Fonts and Textures.
+   * @remarks Cloning a fully loaded and styled prototype is considerably faster than loading
+   * the same View from JSON, and is well suited to table rows and collection items.
+   * @memberof View
+   */
+  View *(*clone)(const View *self);
+
   /**
    * @fn SDL_Rect View::clippingFrame(const View *self)
    * @param self The View.
@@ -502,6 +557,19 @@ struct ViewInterface {
    */
   bool (*containsPoint)(const View *self, const SDL_Point *point);
 
+  /**
+   * @fn View *View::counterpart(const View *self, const View *prototype, const View *descendant)
+   * @param self The View, which has been awoken with `prototype`.
+   * @param prototype The prototype.
+   * @param descendant A descendant of `prototype`, or `NULL`.
+   * @return The descendant of this View at the position of `descendant` within `prototype`, or
+   * `NULL` if there is none.
+   * @remarks Subclasses that retain their subviews use this in View::awakeWithPrototype to rebind
+   * them, as subviews of a different Class than their prototype's are replaced.
+   * @memberof View
+   */
+  View *(*counterpart)(const View *self, const View *prototype, const View *descendant);
+
   /**
    * @fn int View::depth(const View *self)
    * @param self The View.
@@ -662,6 +730,17 @@ struct ViewInterface {
    */
   void (*enumerateVisible)(View *self, ViewEnumerator enumerator, ident data);
 
+  /**
+   * @fn void View::evictTextures(View *self)
+   * @brief Releases the Textures this View holds, to reclaim GPU memory.
+   * @details Views must recreate their Textures lazily the next time they are rendered. The
+   * default implementation of this method does nothing.
+   * @param self The View.
+   * @see View::textureMemory(const View *)
+   * @memberof View
+   */
+  void (*evictTextures)(View *self);
+
   /**
    * @fn bool View::hasClassName(const View *self, cosnt char *className)
    * @param self The View
@@ -720,6 +799,31 @@ struct ViewInterface {
    */
   void (*invalidateStyle)(View *self);
 
+  /**
+   * @fn void View::invalidateStyleForSimpleSelector(View *self, SimpleSelectorType type, const char *pattern)
+   * @brief Invalidates the computed Style of this View, and of any related Views, after a change
+   * to one of its class names, its identifier or a pseudo-class.
+   * @param self The View.
+   * @param type The SimpleSelectorType, one of class, id or pseudo-class.
+   * @param pattern The class name, identifier or pseudo-class that changed.
+   * @remarks Only those Views whose matched Selectors may change, according to the Theme's
+   * InvalidationSets, are invalidated. If this View is not in a window, its computed Style and
+   * those of its descendants are simply invalidated.
+   * @memberof View
+   */
+  void (*invalidateStyleForSimpleSelector)(View *self, SimpleSelectorType type, const char *pattern);
+
+  /**
+   * @fn void View::invalidateStyleForSelectors(View *self, const Array *selectors)
+   * @brief Invalidates the computed Style of this View, and of any of its descendants, matched
+   * by any of the given Selectors.
+   * @param self The View.
+   * @param selectors The Selectors that were added, removed or changed.
+   * @see Stylesheet::changedSelectors(const Stylesheet *, const Stylesheet *)
+   * @memberof View
+   */
+  void (*invalidateStyleForSelectors)(View *self, const Array *selectors);
+
   /**
    * @fn bool View::isContainer(const View *self)
    * @param self The view.
@@ -1028,6 +1132,27 @@ struct ViewInterface {
    */
   View *(*subviewWithIdentifier)(const View *self, const char *identifier);
 
+  /**
+   * @fn Texture *View::texture(const View *self)
+   * @param self The View.
+   * @return The Texture this View holds, or `NULL`.
+   * @remarks The default implementation of this method returns `NULL`.
+   * @see View::evictTextures(View *)
+   * @memberof View
+   */
+  Texture *(*texture)(const View *self);
+
+  /**
+   * @fn size_t View::textureMemory(const View *self)
+   * @param self The View.
+   * @return The size in bytes of the Texture this View holds.
+   * @remarks Textures shared with other Views, or with the Renderer's Image Texture cache, are
+   * counted once by Renderer::manageTextures. The default implementation of this method
+   * returns `0`.
+   * @memberof View
+   */
+  size_t (*textureMemory)(const View *self);
+
   /**
    * @fn void View::updateBindings(View *self)
    * @brief Updates data bindings, prompting the appropriate layout changes.
@@ -1060,9 +1185,10 @@ struct ViewInterface {
    * @static
    * @fn View *View::viewWithData(const Data *data, Outlet *outlets)
    * @brief Instantiates a View initialized with the contents of `data`.
-   * @param data A Data containing JSON describing a View.
+   * @param data A Data containing JSON describing a View, or a compiled ViewTemplate.
    * @param outlets An optional array of Outlets to resolve.
    * @return The initialized View, or `NULL` on error.
+   * @see ViewTemplate
    * @memberof View
    */
   View *(*viewWithData)(const Data *data, Outlet *outlets);
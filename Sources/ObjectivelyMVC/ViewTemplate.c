@@ -0,0 +1,477 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/JSONContext.h>
+#include <Objectively/MutableData.h>
+
+#include "CompiledData.h"
+#include "Log.h"
+#include "ViewTemplate.h"
+
+#define _Class _ViewTemplate
+
+/**
+ * @brief A View description, with its Class resolved.
+ */
+struct ViewTemplateNode {
+
+  /**
+   * @brief The View Class.
+   */
+  Class *clazz;
+
+  /**
+   * @brief The View description, without its `class` and `subviews`.
+   */
+  Dictionary *dictionary;
+
+  /**
+   * @brief The subview nodes.
+   */
+  ViewTemplateNode **subviews;
+
+  /**
+   * @brief The count of `subviews`.
+   */
+  size_t numSubviews;
+
+  /**
+   * @brief True if Views of this node and all of its descendants may be cloned.
+   */
+  bool cloneable;
+
+  /**
+   * @brief The prototype from which this node is cloned, once it has been instantiated.
+   */
+  View *prototype;
+};
+
+/**
+ * @brief Frees the given node and its descendants.
+ */
+static void freeNode(ViewTemplateNode *node) {
+
+  if (node) {
+    for (size_t i = 0; i < node->numSubviews; i++) {
+      freeNode(node->subviews[i]);
+    }
+
+    free(node->subviews);
+
+    release(node->dictionary);
+    release(node->prototype);
+
+    free(node);
+  }
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+  ViewTemplate *this = (ViewTemplate *) self;
+
+  release(this->dictionary);
+
+  freeNode(this->root);
+
+  super(Object, self, dealloc);
+}
+
+#pragma mark - ViewTemplate
+
+/**
+ * @fn Data *ViewTemplate::compiledData(const ViewTemplate *self)
+ * @memberof ViewTemplate
+ */
+static Data *compiledData(const ViewTemplate *self) {
+
+  CompiledStringTable table = {
+    .indexes = $$(Dictionary, dictionaryWithCapacity, 64),
+    .strings = $$(Array, arrayWithCapacity, 64)
+  };
+
+  assert(table.indexes);
+  assert(table.strings);
+
+  MutableData *tree = $$(MutableData, dataWithCapacity, 4096);
+  assert(tree);
+
+  MVC_WriteCompiledValue(tree, &table, (Object *) self->dictionary);
+
+  MutableData *data = $$(MutableData, dataWithCapacity, ((Data *) tree)->length + 1024);
+  assert(data);
+
+  $(data, appendBytes, (const uint8_t *) VIEW_TEMPLATE_COMPILED_MAGIC, 4);
+  MVC_WriteCompiledInteger(data, VIEW_TEMPLATE_COMPILED_VERSION);
+
+  MVC_WriteCompiledInteger(data, (uint32_t) table.strings->count);
+  for (size_t i = 0; i < table.strings->count; i++) {
+    MVC_WriteCompiledString(data, ((String *) table.strings->elements[i])->chars);
+  }
+
+  $(data, appendBytes, ((Data *) tree)->bytes, ((Data *) tree)->length);
+
+  release(tree);
+  release(table.strings);
+  release(table.indexes);
+
+  return (Data *) data;
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::initWithCompiledData(ViewTemplate *self, const Data *data)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *initWithCompiledData(ViewTemplate *self, const Data *data) {
+
+  assert(data);
+
+  if (!MVC_IsCompiledViewTemplate(data)) {
+    MVC_LogError("Not a compiled ViewTemplate\n");
+    return release(self);
+  }
+
+  CompiledReader reader = {
+    .bytes = data->bytes + 4,
+    .end = data->bytes + data->length
+  };
+
+  const uint32_t version = MVC_ReadCompiledInteger(&reader);
+  if (version != VIEW_TEMPLATE_COMPILED_VERSION) {
+    MVC_LogError("Unsupported compiled ViewTemplate version %u\n", version);
+    return release(self);
+  }
+
+  const uint32_t numStrings = MVC_ReadCompiledCount(&reader);
+
+  Array *strings = $$(Array, arrayWithCapacity, numStrings);
+  assert(strings);
+
+  for (uint32_t i = 0; i < numStrings && !reader.error; i++) {
+
+    String *string = $$(String, stringWithCharacters, MVC_ReadCompiledString(&reader));
+    assert(string);
+
+    $(strings, addObject, string);
+    release(string);
+  }
+
+  reader.strings = strings;
+
+  ident root = reader.error ? NULL : MVC_ReadCompiledValue(&reader);
+
+  if (reader.error || reader.bytes != reader.end || cast(Dictionary, root) == NULL) {
+    MVC_LogError("Malformed compiled ViewTemplate\n");
+    self = release(self);
+  } else {
+    self = $(self, initWithDictionary, root);
+  }
+
+  release(root);
+  release(strings);
+
+  return self;
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::initWithData(ViewTemplate *self, const Data *data)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *initWithData(ViewTemplate *self, const Data *data) {
+
+  assert(data);
+
+  if (MVC_IsCompiledViewTemplate(data)) {
+    return $(self, initWithCompiledData, data);
+  }
+
+  JSONContext *ctx = $(alloc(JSONContext), init);
+  Dictionary *dictionary = $(ctx, objectFromData, data, 0);
+
+  if (dictionary) {
+    self = $(self, initWithDictionary, dictionary);
+    release(dictionary);
+  } else {
+    MVC_LogError("Failed to parse JSON\n");
+    self = release(self);
+  }
+
+  release(ctx);
+  return self;
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::initWithDictionary(ViewTemplate *self, const Dictionary *dictionary)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *initWithDictionary(ViewTemplate *self, const Dictionary *dictionary) {
+
+  assert(dictionary);
+
+  self = (ViewTemplate *) super(Object, self, init);
+  if (self) {
+    self->dictionary = retain((Dictionary *) dictionary);
+  }
+
+  return self;
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::initWithResourceName(ViewTemplate *self, const char *name)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *initWithResourceName(ViewTemplate *self, const char *name) {
+
+  assert(name);
+
+  Resource *resource = $$(Resource, resourceWithName, name);
+  if (resource == NULL) {
+    MVC_LogError("Failed to load %s\n", name);
+    return release(self);
+  }
+
+  self = $(self, initWithData, resource->data);
+
+  release(resource);
+  return self;
+}
+
+/**
+ * @return True if Views of the given Class are fully copied by View::awakeWithPrototype.
+ * @remarks A Class that binds its own Inlets in View::awakeWithDictionary must also copy them
+ * in View::awakeWithPrototype, or its Views are instantiated from their description instead.
+ */
+static bool isCloneable(const Class *clazz) {
+
+  for (const Class *c = clazz; c != _View(); c = c->def.superclass) {
+
+    const ViewInterface *interface = interfaceof(View, c);
+    const ViewInterface *superInterface = interfaceof(View, c->def.superclass);
+
+    if (interface->awakeWithDictionary != superInterface->awakeWithDictionary) {
+      if (interface->awakeWithPrototype == superInterface->awakeWithPrototype) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @return A new node for the given View description, or `NULL` on error.
+ */
+static ViewTemplateNode *newNode(const Dictionary *dictionary) {
+
+  Class *clazz = _View();
+
+  const String *className = $(dictionary, objectForKeyPath, "class");
+  if (className) {
+
+    clazz = classForName(cast(String, className)->chars);
+
+    const Class *c = clazz;
+    while (c && c != _View()) {
+      c = c->def.superclass;
+    }
+
+    if (c == NULL) {
+      MVC_LogError("%s is not a known View class\n", className->chars);
+      return NULL;
+    }
+
+    if (clazz != _View()) {
+      if (interfaceof(View, clazz)->init == interfaceof(View, clazz->def.superclass)->init) {
+        MVC_LogWarn("%s does not implement View::init\n", clazz->def.name);
+      }
+    }
+  }
+
+  ViewTemplateNode *node = calloc(1, sizeof(ViewTemplateNode));
+  assert(node);
+
+  node->clazz = clazz;
+  node->cloneable = isCloneable(clazz);
+
+  node->dictionary = $$(Dictionary, dictionaryWithCapacity, dictionary->count);
+  assert(node->dictionary);
+
+  Array *keys = $(dictionary, allKeys);
+  assert(keys);
+
+  for (size_t i = 0; i < keys->count; i++) {
+
+    const String *key = keys->elements[i];
+    if (strcmp(key->chars, "class") && strcmp(key->chars, "subviews")) {
+      $(node->dictionary, setObjectForKey, $(dictionary, objectForKey, (ident) key), (ident) key);
+    }
+  }
+
+  release(keys);
+
+  const Array *subviews = $(dictionary, objectForKeyPath, "subviews");
+  if (subviews) {
+
+    node->subviews = calloc(cast(Array, subviews)->count, sizeof(ViewTemplateNode *));
+    assert(node->subviews || subviews->count == 0);
+
+    for (size_t i = 0; i < subviews->count; i++) {
+
+      ViewTemplateNode *subview = newNode(cast(Dictionary, subviews->elements[i]));
+      if (subview == NULL) {
+        freeNode(node);
+        return NULL;
+      }
+
+      node->subviews[node->numSubviews++] = subview;
+      node->cloneable &= subview->cloneable;
+    }
+  }
+
+  return node;
+}
+
+/**
+ * @return A new View for the given node.
+ * @param cloned True if the parent of `node` is cloned, in which case `node` is not.
+ */
+static View *instantiateNode(ViewTemplateNode *node, bool cloned) {
+
+  if (node->prototype) {
+    return $(node->prototype, clone);
+  }
+
+  View *view = $((View *) _alloc(node->clazz), init);
+  assert(view);
+
+  $(view, awakeWithDictionary, node->dictionary);
+
+  for (size_t i = 0; i < node->numSubviews; i++) {
+
+    View *subview = instantiateNode(node->subviews[i], node->cloneable);
+    assert(subview);
+
+    $(view, addSubview, subview);
+    release(subview);
+  }
+
+  if (node->cloneable && !cloned) {
+    node->prototype = $(view, clone);
+  }
+
+  return view;
+}
+
+/**
+ * @fn View *ViewTemplate::instantiate(const ViewTemplate *self, Outlet *outlets)
+ * @memberof ViewTemplate
+ */
+static View *instantiate(const ViewTemplate *self, Outlet *outlets) {
+
+  ViewTemplate *this = (ViewTemplate *) self;
+
+  if (this->root == NULL) {
+    this->root = newNode(self->dictionary);
+    if (this->root == NULL) {
+      return NULL;
+    }
+  }
+
+  View *view = instantiateNode(this->root, false);
+
+  $(view, resolve, outlets);
+
+  return view;
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::viewTemplateWithData(const Data *data)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *viewTemplateWithData(const Data *data) {
+  return $(alloc(ViewTemplate), initWithData, data);
+}
+
+/**
+ * @fn ViewTemplate *ViewTemplate::viewTemplateWithResourceName(const char *name)
+ * @memberof ViewTemplate
+ */
+static ViewTemplate *viewTemplateWithResourceName(const char *name) {
+  return $(alloc(ViewTemplate), initWithResourceName, name);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+  ((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+  ((ViewTemplateInterface *) clazz->interface)->compiledData = compiledData;
+  ((ViewTemplateInterface *) clazz->interface)->initWithCompiledData = initWithCompiledData;
+  ((ViewTemplateInterface *) clazz->interface)->initWithData = initWithData;
+  ((ViewTemplateInterface *) clazz->interface)->initWithDictionary = initWithDictionary;
+  ((ViewTemplateInterface *) clazz->interface)->initWithResourceName = initWithResourceName;
+  ((ViewTemplateInterface *) clazz->interface)->instantiate = instantiate;
+  ((ViewTemplateInterface *) clazz->interface)->viewTemplateWithData = viewTemplateWithData;
+  ((ViewTemplateInterface *) clazz->interface)->viewTemplateWithResourceName = viewTemplateWithResourceName;
+}
+
+/**
+ * @fn Class *ViewTemplate::_ViewTemplate(void)
+ * @memberof ViewTemplate
+ */
+Class *_ViewTemplate(void) {
+  static Class *clazz;
+  static Once once;
+
+  do_once(&once, {
+    clazz = _initialize(&(const ClassDef) {
+      .name = "ViewTemplate",
+      .superclass = _Object(),
+      .instanceSize = sizeof(ViewTemplate),
+      .interfaceOffset = offsetof(ViewTemplate, interface),
+      .interfaceSize = sizeof(ViewTemplateInterface),
+      .initialize = initialize,
+    });
+  });
+
+  return clazz;
+}
+
+#undef _Class
+
+bool MVC_IsCompiledViewTemplate(const Data *data) {
+  return data && data->length >= 4 && memcmp(data->bytes, VIEW_TEMPLATE_COMPILED_MAGIC, 4) == 0;
+}
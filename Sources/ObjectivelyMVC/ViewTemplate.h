@@ -0,0 +1,193 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+#include <Objectively/Dictionary.h>
+#include <Objectively/Resource.h>
+
+#include <ObjectivelyMVC/View.h>
+
+/**
+ * @file
+ * @brief ViewTemplates are parsed, validated View descriptions for fast, repeated instantiation.
+ */
+
+/**
+ * @brief The leading bytes of compiled ViewTemplates.
+ */
+#define VIEW_TEMPLATE_COMPILED_MAGIC "MVCV"
+
+/**
+ * @brief The version of the compiled ViewTemplate format.
+ * @remarks Increment this whenever the format changes, so that stale blobs are rejected.
+ */
+#define VIEW_TEMPLATE_COMPILED_VERSION 1
+
+typedef struct ViewTemplate ViewTemplate;
+typedef struct ViewTemplateInterface ViewTemplateInterface;
+typedef struct ViewTemplateNode ViewTemplateNode;
+
+/**
+ * @brief ViewTemplates hold the description of a View hierarchy, as loaded from JSON or from
+ * the compiled binary form produced by ViewTemplate::compiledData.
+ * @details Loading a ViewTemplate parses its description once. The first call to
+ * ViewTemplate::instantiate resolves the View Class of each description in the hierarchy, and
+ * later calls create Views of those Classes directly. Subtrees whose Classes are fully copied by
+ * View::awakeWithPrototype are not bound again at all: they are cloned from the Views created
+ * by the first call. This makes ViewTemplates well suited to table rows, dialogs, and other
+ * layouts that are instantiated repeatedly.
+ * @extends Object
+ */
+struct ViewTemplate {
+
+  /**
+   * @brief The superclass.
+   */
+  Object object;
+
+  /**
+   * @brief The interface.
+   * @protected
+   */
+  ViewTemplateInterface *interface;
+
+  /**
+   * @brief The Dictionary describing the root View.
+   */
+  Dictionary *dictionary;
+
+  /**
+   * @brief The resolved root View description, created by the first instantiation.
+   * @private
+   */
+  ViewTemplateNode *root;
+};
+
+/**
+ * @brief The ViewTemplate interface.
+ */
+struct ViewTemplateInterface {
+
+  /**
+   * @brief The superclass interface.
+   */
+  ObjectInterface objectInterface;
+
+  /**
+   * @fn Data *ViewTemplate::compiledData(const ViewTemplate *self)
+   * @brief Compiles this ViewTemplate to a versioned binary representation.
+   * @param self The ViewTemplate.
+   * @return The compiled ViewTemplate Data, which may be loaded without parsing JSON.
+   * @see ViewTemplate::initWithCompiledData(ViewTemplate *, const Data *)
+   * @memberof ViewTemplate
+   */
+  Data *(*compiledData)(const ViewTemplate *self);
+
+  /**
+   * @fn ViewTemplate *ViewTemplate::initWithCompiledData(ViewTemplate *self, const Data *data)
+   * @brief Initializes this ViewTemplate with compiled ViewTemplate Data.
+   * @param self The ViewTemplate.
+   * @param data The Data, as returned by ViewTemplate::compiledData.
+   * @return The initialized ViewTemplate, or `NULL` if `data` is malformed or of another version.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*initWithCompiledData)(ViewTemplate *self, const Data *data);
+
+  /**
+   * @fn ViewTemplate *ViewTemplate::initWithData(ViewTemplate *self, const Data *data)
+   * @brief Initializes this ViewTemplate with the View description in `data`.
+   * @param self The ViewTemplate.
+   * @param data The Data containing JSON describing a View, or a compiled ViewTemplate.
+   * @return The initialized ViewTemplate, or `NULL` on error.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*initWithData)(ViewTemplate *self, const Data *data);
+
+  /**
+   * @fn ViewTemplate *ViewTemplate::initWithDictionary(ViewTemplate *self, const Dictionary *dictionary)
+   * @brief Initializes this ViewTemplate with the given View description.
+   * @param self The ViewTemplate.
+   * @param dictionary A Dictionary describing a View.
+   * @return The initialized ViewTemplate, or `NULL` on error.
+   * @remarks Designated initializer.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*initWithDictionary)(ViewTemplate *self, const Dictionary *dictionary);
+
+  /**
+   * @fn ViewTemplate *ViewTemplate::initWithResourceName(ViewTemplate *self, const char *name)
+   * @brief Initializes this ViewTemplate with the Resource by the specified `name`.
+   * @param self The ViewTemplate.
+   * @param name The name of a Resource containing JSON or a compiled ViewTemplate.
+   * @return The initialized ViewTemplate, or `NULL` on error.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*initWithResourceName)(ViewTemplate *self, const char *name);
+
+  /**
+   * @fn View *ViewTemplate::instantiate(const ViewTemplate *self, Outlet *outlets)
+   * @brief Instantiates a new View hierarchy from this ViewTemplate.
+   * @param self The ViewTemplate.
+   * @param outlets An optional array of Outlets to resolve.
+   * @return The new View, or `NULL` if a View Class can not be resolved.
+   * @remarks The description is resolved on the first call, so later changes to `dictionary`
+   * have no effect on later calls.
+   * @memberof ViewTemplate
+   */
+  View *(*instantiate)(const ViewTemplate *self, Outlet *outlets);
+
+  /**
+   * @static
+   * @fn ViewTemplate *ViewTemplate::viewTemplateWithData(const Data *data)
+   * @brief Instantiates a new ViewTemplate with the View description in `data`.
+   * @param data The Data containing JSON describing a View, or a compiled ViewTemplate.
+   * @return The new ViewTemplate, or `NULL` on error.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*viewTemplateWithData)(const Data *data);
+
+  /**
+   * @static
+   * @fn ViewTemplate *ViewTemplate::viewTemplateWithResourceName(const char *name)
+   * @brief Instantiates a new ViewTemplate with the Resource by the specified `name`.
+   * @param name The name of a Resource containing JSON or a compiled ViewTemplate.
+   * @return The new ViewTemplate, or `NULL` on error.
+   * @memberof ViewTemplate
+   */
+  ViewTemplate *(*viewTemplateWithResourceName)(const char *name);
+};
+
+/**
+ * @fn Class *ViewTemplate::_ViewTemplate(void)
+ * @brief The ViewTemplate archetype.
+ * @return The ViewTemplate Class.
+ * @memberof ViewTemplate
+ */
+OBJECTIVELYMVC_EXPORT Class *_ViewTemplate(void);
+
+/**
+ * @return True if `data` begins with the compiled ViewTemplate magic.
+ */
+OBJECTIVELYMVC_EXPORT bool MVC_IsCompiledViewTemplate(const Data *data);
@@ -22,6 +22,8 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <Objectively/String.h>
 
@@ -43,10 +45,10 @@ static void mouseMotion_enumerate(View *view, ident data) {
 
   if ($(view, containsPoint, &a) && !$(view, containsPoint, &b)) {
     $(view, emitViewEvent, ViewEventMouseLeave, NULL);
-    $(view, invalidateStyle);
+    $(view, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, "hover");
   } else if ($(view, containsPoint, &b) && !$(view, containsPoint, &a)) {
     $(view, emitViewEvent, ViewEventMouseEnter, NULL);
-    $(view, invalidateStyle);
+    $(view, invalidateStyleForSimpleSelector, SimpleSelectorTypePseudo, "hover");
   }
 }
 
@@ -64,6 +66,13 @@ static void dealloc(Object *self) {
   release(this->theme);
   release(this->viewController);
 
+  for (size_t i = 0; i < this->numWatches; i++) {
+    free(this->watches[i].path);
+    release(this->watches[i].stylesheet);
+  }
+
+  free(this->watches);
+
   super(Object, self, dealloc);
 }
 
@@ -148,6 +157,89 @@ static WindowController *initWithDevice(WindowController *self, RenderDevice *de
   return self;
 }
 
+/**
+ * @fn void WindowController::reloadStylesheet(WindowController *self, Stylesheet *stylesheet, Stylesheet *replacement)
+ * @memberof WindowController
+ */
+static void reloadStylesheet(WindowController *self, Stylesheet *stylesheet, Stylesheet *replacement) {
+
+  assert(stylesheet);
+  assert(replacement);
+
+  Array *selectors = $(stylesheet, changedSelectors, replacement);
+  assert(selectors);
+
+  if ($(self->theme, replaceStylesheet, stylesheet, replacement)) {
+
+    MVC_LogDebug("%u rules changed\n", (unsigned) selectors->count);
+
+    $(self->viewController->view, invalidateStyleForSelectors, selectors);
+
+    if (self->debugViewController) {
+      $(((ViewController *) self->debugViewController)->view, invalidateStyleForSelectors, selectors);
+    }
+  } else {
+    MVC_LogWarn("Stylesheet does not belong to the Theme\n");
+  }
+
+  release(selectors);
+}
+
+/**
+ * @return The Stylesheet at `path`, or `NULL` if it could not be read.
+ */
+static Stylesheet *readStylesheet(const char *path) {
+
+  Data *data = $$(Data, dataWithContentsOfFile, path);
+  if (data == NULL) {
+    MVC_LogError("Failed to read %s\n", path);
+    return NULL;
+  }
+
+  Stylesheet *stylesheet = $$(Stylesheet, stylesheetWithData, data);
+
+  release(data);
+  return stylesheet;
+}
+
+/**
+ * @brief Reloads any watched Stylesheets whose files have been modified.
+ */
+static void reloadWatchedStylesheets(WindowController *self) {
+
+  if (self->numWatches == 0) {
+    return;
+  }
+
+  const Uint64 now = SDL_GetTicks();
+  if (now - self->watchTimestamp < STYLESHEET_WATCH_INTERVAL) {
+    return;
+  }
+
+  self->watchTimestamp = now;
+
+  for (size_t i = 0; i < self->numWatches; i++) {
+    StylesheetWatch *watch = &self->watches[i];
+
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(watch->path, &info) || info.modify_time == watch->modifyTime) {
+      continue;
+    }
+
+    watch->modifyTime = info.modify_time;
+
+    Stylesheet *stylesheet = readStylesheet(watch->path);
+    if (stylesheet) {
+      MVC_LogInfo("Reloading %s\n", watch->path);
+
+      $(self, reloadStylesheet, watch->stylesheet, stylesheet);
+
+      release(watch->stylesheet);
+      watch->stylesheet = stylesheet;
+    }
+  }
+}
+
 /**
  * @fn void WindowController::render(WindowController *self)
  * @memberof WindowController
@@ -172,12 +264,16 @@ static void renderTo(WindowController *self, CommandBuffer *commands, Framebuffe
 
   $(self->renderer, beginFrameWith, commands, framebuffer);
 
+  reloadWatchedStylesheets(self);
+
   $(self->viewController->view, applyThemeIfNeeded, self->theme);
   $(self->viewController->view, layoutIfNeeded);
   $(self->viewController->view, draw, self->renderer);
 
   $(self, debug);
 
+  $(self->renderer, manageTextures, self->viewController->view);
+
   $(self->renderer, endFrame);
 }
 
@@ -491,6 +587,40 @@ static View *touchTarget(const WindowController *self, const SDL_Event *event) {
   return $(self->viewController->view, hitTest, &point);
 }
 
+/**
+ * @fn Stylesheet *WindowController::watchStylesheet(WindowController *self, const char *path)
+ * @memberof WindowController
+ */
+static Stylesheet *watchStylesheet(WindowController *self, const char *path) {
+
+  assert(path);
+
+  SDL_PathInfo info;
+  if (!SDL_GetPathInfo(path, &info)) {
+    MVC_LogError("%s: %s\n", path, SDL_GetError());
+    return NULL;
+  }
+
+  Stylesheet *stylesheet = readStylesheet(path);
+  if (stylesheet == NULL) {
+    return NULL;
+  }
+
+  self->watches = realloc(self->watches, (self->numWatches + 1) * sizeof(StylesheetWatch));
+  assert(self->watches);
+
+  self->watches[self->numWatches++] = (StylesheetWatch) {
+    .path = strdup(path),
+    .modifyTime = info.modify_time,
+    .stylesheet = stylesheet
+  };
+
+  $(self->theme, addStylesheet, stylesheet);
+  $(self->viewController->view, invalidateStyle);
+
+  return stylesheet;
+}
+
 /**
  * @fn WindowController *WindowController::windowController(SDL_Window *window)
  * @memberof WindowController
@@ -517,6 +647,7 @@ static void initialize(Class *clazz) {
   ((WindowControllerInterface *) clazz->interface)->initWithDevice = initWithDevice;
   ((WindowControllerInterface *) clazz->interface)->nextKeyResponder = nextKeyResponder;
   ((WindowControllerInterface *) clazz->interface)->previousKeyResponder = previousKeyResponder;
+  ((WindowControllerInterface *) clazz->interface)->reloadStylesheet = reloadStylesheet;
   ((WindowControllerInterface *) clazz->interface)->render = render;
   ((WindowControllerInterface *) clazz->interface)->renderTo = renderTo;
   ((WindowControllerInterface *) clazz->interface)->respondToEvent = respondToEvent;
@@ -526,6 +657,7 @@ static void initialize(Class *clazz) {
   ((WindowControllerInterface *) clazz->interface)->toggleDebugger = toggleDebugger;
   ((WindowControllerInterface *) clazz->interface)->touchResponder = touchResponder;
   ((WindowControllerInterface *) clazz->interface)->touchTarget = touchTarget;
+  ((WindowControllerInterface *) clazz->interface)->watchStylesheet = watchStylesheet;
   ((WindowControllerInterface *) clazz->interface)->windowController = windowController;
 }
 
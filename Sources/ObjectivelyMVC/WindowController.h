@@ -37,6 +37,33 @@
 typedef struct WindowController WindowController;
 typedef struct WindowControllerInterface WindowControllerInterface;
 
+/**
+ * @brief The interval, in milliseconds, at which watched Stylesheets are checked for changes.
+ */
+#define STYLESHEET_WATCH_INTERVAL 500
+
+/**
+ * @brief A Stylesheet watched for changes on disk.
+ * @see WindowController::watchStylesheet(WindowController *, const char *)
+ */
+typedef struct {
+
+  /**
+   * @brief The file path.
+   */
+  char *path;
+
+  /**
+   * @brief The modification time of the file when it was last loaded.
+   */
+  SDL_Time modifyTime;
+
+  /**
+   * @brief The Stylesheet most recently loaded from the file.
+   */
+  Stylesheet *stylesheet;
+} StylesheetWatch;
+
 /**
  * @brief A WindowController manages a ViewController and its descendants within an SDL_Window.
  * @extends Object
@@ -75,6 +102,24 @@ struct WindowController {
    */
   ViewController *viewController;
 
+  /**
+   * @brief The Stylesheets watched for changes on disk.
+   * @private
+   */
+  StylesheetWatch *watches;
+
+  /**
+   * @brief The count of `watches`.
+   * @private
+   */
+  size_t numWatches;
+
+  /**
+   * @brief The time at which `watches` were last checked.
+   * @private
+   */
+  Uint64 watchTimestamp;
+
   /**
    * @brief The window.
    */
@@ -146,6 +191,19 @@ struct WindowControllerInterface {
    */
   View *(*previousKeyResponder)(const WindowController *self, View *keyResponder);
 
+  /**
+   * @fn void WindowController::reloadStylesheet(WindowController *self, Stylesheet *stylesheet, Stylesheet *replacement)
+   * @brief Replaces a Stylesheet of this WindowController's Theme with a revision of it.
+   * @param self The WindowController.
+   * @param stylesheet The Stylesheet.
+   * @param replacement The revised Stylesheet.
+   * @remarks Rather than re-theming the entire View hierarchy, only those Views matched by rules
+   * that were added, removed or changed are invalidated.
+   * @see Stylesheet::changedSelectors(const Stylesheet *, const Stylesheet *)
+   * @memberof WindowController
+   */
+  void (*reloadStylesheet)(WindowController *self, Stylesheet *stylesheet, Stylesheet *replacement);
+
   /**
    * @fn void WindowController::render(WindowController *self)
    * @brief Renders the ViewController's View into the RenderDevice's current frame.
@@ -243,6 +301,20 @@ struct WindowControllerInterface {
    */
   View *(*touchTarget)(const WindowController *self, const SDL_Event *event);
 
+  /**
+   * @fn Stylesheet *WindowController::watchStylesheet(WindowController *self, const char *path)
+   * @brief Adds the Stylesheet at `path` to this WindowController's Theme, and reloads it
+   * whenever the file is modified.
+   * @param self The WindowController.
+   * @param path The path of a CSS or compiled Stylesheet file.
+   * @return The Stylesheet, or `NULL` if the file could not be read.
+   * @remarks This is intended for live editing of Stylesheets during development. The file is
+   * checked every ::STYLESHEET_WATCH_INTERVAL milliseconds, as frames are rendered.
+   * @see WindowController::reloadStylesheet(WindowController *, Stylesheet *, Stylesheet *)
+   * @memberof WindowController
+   */
+  Stylesheet *(*watchStylesheet)(WindowController *self, const char *path);
+
   /**
    * @static
    * @fn WindowController *WindowController::windowController(SDL_Window *window)
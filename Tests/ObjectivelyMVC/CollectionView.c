@@ -0,0 +1,130 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+/**
+ * @see CollectionViewDataSource::numberOfItems
+ */
+static size_t numberOfItems(const CollectionView *collectionView) {
+  return 10;
+}
+
+/**
+ * @see CollectionViewDelegate::itemForObjectAtIndexPath
+ */
+static CollectionItemView *itemForObjectAtIndexPath(const CollectionView *collectionView, const IndexPath *indexPath) {
+
+  CollectionItemView *item = $(collectionView, dequeueReusableItem);
+  if (item == NULL) {
+    item = $(alloc(CollectionItemView), initWithFrame, NULL);
+  }
+
+  return item;
+}
+
+/**
+ * @return The item index at `point`, or `-1`.
+ */
+static ssize_t indexAtPoint(const CollectionView *collectionView, int x, int y) {
+
+  IndexPath *indexPath = $(collectionView, indexPathForItemAtPoint, &MakePoint(x, y));
+  if (indexPath) {
+    const ssize_t index = (ssize_t) $(indexPath, indexAtPosition, 0);
+    release(indexPath);
+    return index;
+  }
+
+  return -1;
+}
+
+START_TEST(indexPathForItemAtPoint) {
+
+  CollectionView *collectionView = $(alloc(CollectionView), initWithFrame, &MakeRect(0, 0, 200, 200));
+  ck_assert_ptr_ne(NULL, collectionView);
+
+  View *scrollView = (View *) collectionView->scrollView;
+  scrollView->frame = MakeRect(0, 0, 200, 200);
+  scrollView->padding = MakePadding(10, 10, 10, 10);
+
+  collectionView->contentView->padding = MakePadding(5, 5, 5, 5);
+
+  collectionView->itemSize = MakeSize(40, 40);
+  collectionView->itemSpacing = MakeSize(10, 10);
+
+  collectionView->dataSource.numberOfItems = numberOfItems;
+  collectionView->delegate.itemForObjectAtIndexPath = itemForObjectAtIndexPath;
+
+  $(collectionView, reloadData);
+  $((View *) collectionView, layoutIfNeeded);
+
+  ck_assert_int_eq(10, collectionView->numberOfItems);
+
+  for (size_t i = 0; i < collectionView->numberOfItems; i++) {
+
+    IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
+
+    const CollectionItemView *item = $(collectionView, itemAtIndexPath, indexPath);
+    ck_assert_ptr_ne(NULL, item);
+
+    const SDL_Rect frame = $((View *) item, renderFrame);
+
+    ck_assert_int_eq((ssize_t) i, indexAtPoint(collectionView, frame.x, frame.y));
+    ck_assert_int_eq((ssize_t) i, indexAtPoint(collectionView, frame.x + frame.w - 1, frame.y + frame.h - 1));
+
+    ck_assert_int_eq(-1, indexAtPoint(collectionView, frame.x + frame.w, frame.y));
+    ck_assert_int_eq(-1, indexAtPoint(collectionView, frame.x, frame.y + frame.h));
+
+    release(indexPath);
+  }
+
+  const SDL_Rect content = $(collectionView->contentView, renderFrame);
+
+  ck_assert_int_eq(-1, indexAtPoint(collectionView, content.x, content.y));
+  ck_assert_int_eq(-1, indexAtPoint(collectionView, content.x + 200, content.y + 15));
+
+  release(collectionView);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("CollectionView");
+  tcase_add_test(tcase, indexPathForItemAtPoint);
+
+  Suite *suite = suite_create("CollectionView");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
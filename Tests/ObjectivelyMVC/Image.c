@@ -0,0 +1,115 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+/**
+ * @brief Creates a 2x2 Image of red, blue, and fully transparent green and white pixels.
+ */
+static Image *createImage(void) {
+
+  SDL_Surface *surface = SDL_CreateSurface(2, 2, SDL_PIXELFORMAT_RGBA32);
+  ck_assert_ptr_ne(NULL, surface);
+
+  const uint8_t pixels[2][8] = {
+    { 255, 0, 0, 255,   0, 0, 255, 255 },
+    { 0, 255, 0, 0,     255, 255, 255, 0 },
+  };
+
+  for (int y = 0; y < 2; y++) {
+    memcpy((uint8_t *) surface->pixels + y * surface->pitch, pixels[y], sizeof(pixels[y]));
+  }
+
+  Image *image = $$(Image, imageWithSurface, surface);
+  ck_assert_ptr_ne(NULL, image);
+
+  SDL_DestroySurface(surface);
+  return image;
+}
+
+START_TEST(scaledImage) {
+
+  Image *image = createImage();
+
+  Image *scaled = $(image, scaledImage, &MakeSize(1, 1));
+  ck_assert_ptr_ne(NULL, scaled);
+
+  const SDL_Size size = $(scaled, size);
+  ck_assert_int_eq(1, size.w);
+  ck_assert_int_eq(1, size.h);
+
+  const uint8_t *pixel = scaled->surface->pixels;
+  ck_assert_int_eq(127, pixel[0]);
+  ck_assert_int_eq(0, pixel[1]);
+  ck_assert_int_eq(127, pixel[2]);
+  ck_assert_int_eq(128, pixel[3]);
+
+  release(scaled);
+
+  scaled = $(image, scaledImage, &MakeSize(2, 1));
+  ck_assert_ptr_ne(NULL, scaled);
+
+  ck_assert_int_eq(2, scaled->surface->w);
+  ck_assert_int_eq(1, scaled->surface->h);
+
+  release(scaled);
+  release(image);
+
+} END_TEST
+
+START_TEST(scaledImageInvalidSize) {
+
+  Image *image = createImage();
+
+  ck_assert_ptr_eq(NULL, $(image, scaledImage, &MakeSize(0, 0)));
+  ck_assert_ptr_eq(NULL, $(image, scaledImage, &MakeSize(1, 0)));
+  ck_assert_ptr_eq(NULL, $(image, scaledImage, &MakeSize(3, 3)));
+  ck_assert_ptr_eq(NULL, $(image, scaledImage, &MakeSize(2, 3)));
+
+  release(image);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("Image");
+  tcase_add_test(tcase, scaledImage);
+  tcase_add_test(tcase, scaledImageInvalidSize);
+
+  Suite *suite = suite_create("Image");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
@@ -0,0 +1,174 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include "ObjectivelyMVC.h"
+
+START_TEST(addIndexesInRange) {
+
+  RangeSet *set = $(alloc(RangeSet), init);
+  ck_assert_ptr_ne(NULL, set);
+
+  $(set, addIndexesInRange, (Range) { .location = 10, .length = 5 });
+  $(set, addIndexesInRange, (Range) { .location = 20, .length = 5 });
+
+  ck_assert_int_eq(2, set->numRanges);
+  ck_assert_int_eq(10, set->count);
+
+  $(set, addIndexesInRange, (Range) { .location = 15, .length = 5 });
+
+  ck_assert_int_eq(1, set->numRanges);
+  ck_assert_int_eq(15, set->count);
+  ck_assert_int_eq(10, set->ranges[0].location);
+  ck_assert_int_eq(15, set->ranges[0].length);
+
+  $(set, addIndex, 9);
+  $(set, addIndex, 12);
+
+  ck_assert_int_eq(1, set->numRanges);
+  ck_assert_int_eq(16, set->count);
+
+  ck_assert($(set, containsIndex, 9));
+  ck_assert($(set, containsIndex, 24));
+  ck_assert(!$(set, containsIndex, 8));
+  ck_assert(!$(set, containsIndex, 25));
+
+  release(set);
+
+} END_TEST
+
+START_TEST(removeIndexesInRange) {
+
+  RangeSet *set = $(alloc(RangeSet), init);
+
+  $(set, addIndexesInRange, (Range) { .location = 0, .length = 100 });
+  $(set, removeIndexesInRange, (Range) { .location = 40, .length = 20 });
+
+  ck_assert_int_eq(2, set->numRanges);
+  ck_assert_int_eq(80, set->count);
+  ck_assert(!$(set, containsIndex, 40));
+  ck_assert(!$(set, containsIndex, 59));
+  ck_assert($(set, containsIndex, 60));
+
+  $(set, removeIndex, 0);
+  $(set, removeIndex, 99);
+
+  ck_assert_int_eq(78, set->count);
+  ck_assert_int_eq(1, set->ranges[0].location);
+
+  $(set, removeAllIndexes);
+
+  ck_assert_int_eq(0, set->numRanges);
+  ck_assert_int_eq(0, set->count);
+
+  release(set);
+
+} END_TEST
+
+START_TEST(insertIndexesInRange) {
+
+  RangeSet *set = $(alloc(RangeSet), init);
+
+  $(set, addIndexesInRange, (Range) { .location = 10, .length = 10 });
+  $(set, insertIndexesInRange, (Range) { .location = 15, .length = 5 });
+
+  ck_assert_int_eq(2, set->numRanges);
+  ck_assert_int_eq(10, set->count);
+  ck_assert($(set, containsIndex, 14));
+  ck_assert(!$(set, containsIndex, 15));
+  ck_assert(!$(set, containsIndex, 19));
+  ck_assert($(set, containsIndex, 20));
+  ck_assert($(set, containsIndex, 24));
+
+  $(set, insertIndexesInRange, (Range) { .location = 0, .length = 1 });
+
+  ck_assert($(set, containsIndex, 11));
+  ck_assert(!$(set, containsIndex, 10));
+
+  release(set);
+
+} END_TEST
+
+START_TEST(deleteIndexesInRange) {
+
+  RangeSet *set = $(alloc(RangeSet), init);
+
+  $(set, addIndexesInRange, (Range) { .location = 10, .length = 5 });
+  $(set, addIndexesInRange, (Range) { .location = 20, .length = 5 });
+  $(set, deleteIndexesInRange, (Range) { .location = 15, .length = 5 });
+
+  ck_assert_int_eq(1, set->numRanges);
+  ck_assert_int_eq(10, set->count);
+  ck_assert_int_eq(10, set->ranges[0].location);
+  ck_assert_int_eq(10, set->ranges[0].length);
+
+  $(set, deleteIndexesInRange, (Range) { .location = 0, .length = 12 });
+
+  ck_assert_int_eq(8, set->count);
+  ck_assert_int_eq(0, set->ranges[0].location);
+
+  release(set);
+
+} END_TEST
+
+START_TEST(indexSet) {
+
+  RangeSet *set = $(alloc(RangeSet), init);
+
+  $(set, addIndexesInRange, (Range) { .location = 2, .length = 2 });
+  $(set, addIndex, 7);
+
+  IndexSet *indexSet = $(set, indexSet);
+
+  ck_assert_int_eq(3, indexSet->count);
+  ck_assert_int_eq(2, indexSet->indexes[0]);
+  ck_assert_int_eq(3, indexSet->indexes[1]);
+  ck_assert_int_eq(7, indexSet->indexes[2]);
+
+  release(indexSet);
+  release(set);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("RangeSet");
+  tcase_add_test(tcase, addIndexesInRange);
+  tcase_add_test(tcase, removeIndexesInRange);
+  tcase_add_test(tcase, insertIndexesInRange);
+  tcase_add_test(tcase, deleteIndexesInRange);
+  tcase_add_test(tcase, indexSet);
+
+  Suite *suite = suite_create("RangeSet");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
@@ -0,0 +1,196 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+/**
+ * @brief Comparator for Options by value.
+ */
+static Order compareOptions(const ident a, const ident b) {
+
+  const intptr_t valueA = (intptr_t) ((const Option *) a)->value;
+  const intptr_t valueB = (intptr_t) ((const Option *) b)->value;
+
+  return valueA < valueB ? OrderAscending : valueA > valueB ? OrderDescending : OrderSame;
+}
+
+/**
+ * @return A new Array of Options with the given values.
+ */
+static Array *createOptions(const intptr_t *values, size_t count) {
+
+  Array *options = $$(Array, arrayWithCapacity, count);
+  ck_assert_ptr_ne(NULL, options);
+
+  for (size_t i = 0; i < count; i++) {
+
+    Option *option = $(alloc(Option), initWithTitle, "option", (ident) values[i]);
+    ck_assert_ptr_ne(NULL, option);
+
+    $(options, addObject, option);
+    release(option);
+  }
+
+  return options;
+}
+
+START_TEST(addOptions) {
+
+  Select *select = $(alloc(Select), initWithFrame, NULL);
+  ck_assert_ptr_ne(NULL, select);
+
+  select->comparator = compareOptions;
+
+  Array *options = createOptions((const intptr_t[]) { 3, 1, 2 }, 3);
+  $(select, addOptions, options);
+
+  const Array *selectOptions = (Array *) select->options;
+  ck_assert_int_eq(3, selectOptions->count);
+  ck_assert_int_eq(3, ((View *) select->stackView)->subviews->count);
+
+  for (size_t i = 0; i < selectOptions->count; i++) {
+    ck_assert_int_eq((intptr_t) i + 1, (intptr_t) ((Option *) selectOptions->elements[i])->value);
+  }
+
+  Option *selected = $(select, selectedOption);
+  ck_assert_ptr_ne(NULL, selected);
+  ck_assert_int_eq(1, (intptr_t) selected->value);
+
+  $(select, addOption, "option", (ident) 0);
+
+  ck_assert_int_eq(4, selectOptions->count);
+  ck_assert_ptr_eq(selected, $(select, selectedOption));
+
+  release(options);
+  release(select);
+
+} END_TEST
+
+START_TEST(setOptions) {
+
+  Select *select = $(alloc(Select), initWithFrame, NULL);
+  ck_assert_ptr_ne(NULL, select);
+
+  Array *options = createOptions((const intptr_t[]) { 1, 2, 3, 4 }, 4);
+  $(select, setOptions, options);
+
+  ck_assert_int_eq(4, ((Array *) select->options)->count);
+
+  $(select, selectOptionWithValue, (ident) 3);
+
+  Option *selected = $(select, selectedOption);
+  ck_assert_ptr_ne(NULL, selected);
+  ck_assert_int_eq(3, (intptr_t) selected->value);
+
+  $(select, setOptions, options);
+
+  ck_assert_int_eq(4, ((Array *) select->options)->count);
+  ck_assert_int_eq(4, ((View *) select->stackView)->subviews->count);
+  ck_assert_ptr_eq(selected, $(select, selectedOption));
+
+  Array *replacements = createOptions((const intptr_t[]) { 5, 6 }, 2);
+  $(select, setOptions, replacements);
+
+  ck_assert_int_eq(2, ((Array *) select->options)->count);
+  ck_assert_int_eq(2, ((View *) select->stackView)->subviews->count);
+  selected = $(select, selectedOption);
+  ck_assert_ptr_ne(NULL, selected);
+  ck_assert_int_eq(5, (intptr_t) selected->value);
+
+  release(replacements);
+  release(options);
+  release(select);
+
+} END_TEST
+
+START_TEST(beginUpdates) {
+
+  Select *select = $(alloc(Select), initWithFrame, NULL);
+  ck_assert_ptr_ne(NULL, select);
+
+  select->comparator = compareOptions;
+  select->maxVisibleOptions = 4;
+
+  View *stackView = (View *) select->stackView;
+
+  ((View *) select)->needsLayout = false;
+
+  $(select, beginUpdates);
+
+  for (intptr_t i = 10; i > 0; i--) {
+    $(select, addOption, "option", (ident) i);
+
+    $(select, beginUpdates);
+    $(select, endUpdates);
+  }
+
+  ck_assert_int_eq(10, ((Array *) select->options)->count);
+  ck_assert_int_eq(0, stackView->subviews->count);
+  ck_assert_ptr_eq(NULL, $(select, selectedOption));
+  ck_assert(((View *) select)->needsLayout == false);
+
+  $(select, endUpdates);
+
+  ck_assert(((View *) select)->needsLayout);
+  ck_assert_int_eq(4, stackView->subviews->count);
+
+  const Array *options = (Array *) select->options;
+  for (size_t i = 0; i < options->count; i++) {
+    ck_assert_int_eq((intptr_t) i + 1, (intptr_t) ((Option *) options->elements[i])->value);
+  }
+
+  for (size_t i = 0; i < stackView->subviews->count; i++) {
+    ck_assert_ptr_eq(options->elements[i], stackView->subviews->elements[i]);
+  }
+
+  const Option *selected = $(select, selectedOption);
+  ck_assert_ptr_ne(NULL, selected);
+  ck_assert_int_eq(1, (intptr_t) selected->value);
+
+  release(select);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("Select");
+  tcase_add_test(tcase, addOptions);
+  tcase_add_test(tcase, setOptions);
+  tcase_add_test(tcase, beginUpdates);
+
+  Suite *suite = suite_create("Select");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
@@ -46,10 +46,12 @@ START_TEST(initWithRule) {
   simpleSelector = $(selectorSequence->simpleSelectors, objectAtIndex, 0);
   ck_assert_int_eq(SimpleSelectorTypeType, simpleSelector->type);
   ck_assert_str_eq("Panel", simpleSelector->pattern);
+  ck_assert_ptr_eq(_Panel(), simpleSelector->clazz);
 
   simpleSelector = $(selectorSequence->simpleSelectors, objectAtIndex, 1);
   ck_assert_int_eq(SimpleSelectorTypeId, simpleSelector->type);
   ck_assert_str_eq("main", simpleSelector->pattern);
+  ck_assert_int_eq(0, simpleSelector->atom);
 
   // second sequence
 
@@ -76,6 +78,7 @@ START_TEST(initWithRule) {
   simpleSelector = $(selectorSequence->simpleSelectors, objectAtIndex, 1);
   ck_assert_int_eq(SimpleSelectorTypePseudo, simpleSelector->type);
   ck_assert_str_eq("highlighted", simpleSelector->pattern);
+  ck_assert_int_eq(PseudoClassHighlighted, simpleSelector->pseudoClass);
 
   release(selector);
 
@@ -168,6 +171,30 @@ START_TEST(matchesView) {
     release(selector);
   }
 
+  {
+    View *sibling = $(alloc(View), initWithFrame, NULL);
+    $(view, addSubviewRelativeTo, sibling, subview, ViewPositionBefore);
+
+    Selector *first = $(alloc(Selector), initWithRule, "View:first-child");
+    Selector *last = $(alloc(Selector), initWithRule, "View:last-child");
+    Selector *odd = $(alloc(Selector), initWithRule, "View:nth-child(odd)");
+
+    ck_assert_int_eq(1, $(first, matchesView, sibling));
+    ck_assert_int_eq(0, $(first, matchesView, subview));
+    ck_assert_int_eq(1, $(last, matchesView, subview));
+    ck_assert_int_eq(1, $(odd, matchesView, subview));
+
+    $(view, removeSubview, sibling);
+
+    ck_assert_int_eq(1, $(first, matchesView, subview));
+    ck_assert_int_eq(0, $(odd, matchesView, subview));
+
+    release(first);
+    release(last);
+    release(odd);
+    release(sibling);
+  }
+
   release(subview);
   release(view);
   release(panel);
@@ -293,6 +320,144 @@ START_TEST(_select) {
 
 } END_TEST
 
+START_TEST(filter) {
+
+  View *root = $(alloc(View), initWithFrame, NULL);
+  root->identifier = strdup("root");
+
+  View *container = $(alloc(View), initWithFrame, NULL);
+  $(container, addClassName, "container");
+
+  $(root, addSubview, container);
+
+  Panel *panel = $(alloc(Panel), initWithFrame, NULL);
+  $(container, addSubview, (View *) panel);
+
+  SelectorFilter *filter = $(alloc(SelectorFilter), init);
+  ck_assert_ptr_ne(NULL, filter);
+
+  Selector *a = $(alloc(Selector), initWithRule, "#root .container Panel");
+  ck_assert_int_eq(2, a->numAncestorHashes);
+
+  Selector *b = $(alloc(Selector), initWithRule, ".foo > Panel");
+  ck_assert_int_eq(1, b->numAncestorHashes);
+
+  Selector *c = $(alloc(Selector), initWithRule, ".foo + Panel");
+  ck_assert_int_eq(0, c->numAncestorHashes);
+
+  $(filter, resetWithView, container);
+  ck_assert_ptr_eq(container, filter->view);
+
+  ck_assert_int_eq(0, $(filter, rejectsSelector, a));
+  ck_assert_int_eq(1, $(filter, rejectsSelector, b));
+  ck_assert_int_eq(0, $(filter, rejectsSelector, c));
+
+  $(filter, removeView);
+  ck_assert_ptr_eq(root, filter->view);
+
+  ck_assert_int_eq(1, $(filter, rejectsSelector, a));
+
+  $(filter, addView, container);
+  ck_assert_int_eq(0, $(filter, rejectsSelector, a));
+
+  $(filter, resetWithView, NULL);
+  ck_assert_ptr_eq(NULL, filter->view);
+
+  ck_assert_int_eq(1, $(filter, rejectsSelector, a));
+  ck_assert_int_eq(0, $(filter, rejectsSelector, c));
+
+  release(a);
+  release(b);
+  release(c);
+  release(filter);
+  release(panel);
+  release(container);
+  release(root);
+
+} END_TEST
+
+START_TEST(invalidation) {
+
+  View *container = $(alloc(View), initWithFrame, NULL);
+
+  View *a = $(alloc(View), initWithFrame, NULL);
+  $(a, addClassName, "item");
+  $(container, addSubview, a);
+
+  View *b = $(alloc(View), initWithFrame, NULL);
+  $(container, addSubview, b);
+
+  Selector *selector = $(alloc(Selector), initWithRule, ".container .item");
+
+  InvalidationSet *set = $(alloc(InvalidationSet), init);
+  $(set, addSelector, selector, InvalidationDescendants);
+
+  ck_assert_int_eq(InvalidationDescendants, set->invalidation);
+  ck_assert_int_eq(1, set->selectors->count);
+
+  container->needsApplyTheme = a->needsApplyTheme = b->needsApplyTheme = false;
+
+  $(set, invalidateView, container);
+
+  ck_assert_int_eq(0, container->needsApplyTheme);
+  ck_assert_int_eq(1, a->needsApplyTheme);
+  ck_assert_int_eq(0, b->needsApplyTheme);
+
+  release(set);
+  release(selector);
+  release(b);
+  release(a);
+  release(container);
+
+} END_TEST
+
+START_TEST(classNames) {
+
+  const Atom foo = MVC_Atom("foo");
+  ck_assert_int_ne(0, foo);
+  ck_assert_int_eq(foo, MVC_Atom("foo"));
+  ck_assert_int_eq(foo, MVC_AtomForName("foo"));
+  ck_assert_str_eq("foo", MVC_AtomName(foo));
+  ck_assert_int_eq(0, MVC_AtomForName("never-interned"));
+
+  View *view = $(alloc(View), initWithFrame, NULL);
+  ck_assert_ptr_eq(NULL, view->classNames);
+  ck_assert(!$(view, hasClassName, "foo"));
+
+  $(view, addClassName, "foo");
+  $(view, addClassName, "bar");
+  $(view, addClassName, "foo");
+  ck_assert_int_eq(2, view->numClassNames);
+  ck_assert_int_lt(view->classNames[0], view->classNames[1]);
+
+  ck_assert($(view, hasClassName, "foo"));
+  ck_assert($(view, hasClassName, "bar"));
+  ck_assert(!$(view, hasClassName, "baz"));
+
+  Set *classNames = $(view, classNameSet);
+  ck_assert_int_eq(2, classNames->count);
+  String *bar = $$(String, stringWithCharacters, "bar");
+  ck_assert($(classNames, containsObject, bar));
+  release(bar);
+  release(classNames);
+
+  Selector *selector = $(alloc(Selector), initWithRule, ".foo.bar");
+  ck_assert($(selector, matchesView, view));
+
+  $(view, removeClassName, "foo");
+  ck_assert_int_eq(1, view->numClassNames);
+  ck_assert(!$(view, hasClassName, "foo"));
+  ck_assert(!$(selector, matchesView, view));
+
+  $(view, removeAllClassNames);
+  ck_assert_int_eq(0, view->numClassNames);
+  ck_assert_ptr_eq(NULL, view->classNames);
+
+  release(selector);
+  release(view);
+
+} END_TEST
+
 int main(int argc, char **argv) {
 
   TCase *tcase = tcase_create("Selector");
@@ -300,6 +465,9 @@ int main(int argc, char **argv) {
   tcase_add_test(tcase, compareTo);
   tcase_add_test(tcase, matchesView);
   tcase_add_test(tcase, _select);
+  tcase_add_test(tcase, filter);
+  tcase_add_test(tcase, invalidation);
+  tcase_add_test(tcase, classNames);
 
   Suite *suite = suite_create("Selector");
   suite_add_tcase(suite, tcase);
@@ -100,10 +100,125 @@ START_TEST(style) {
 
 } END_TEST
 
+START_TEST(values) {
+
+  Style *style = $(alloc(Style), initWithRules, NULL);
+
+  $(style, addColorAttribute, "background-color", &MakeColor(0, 64, 128, 255));
+  $(style, addCharactersAttribute, "border-color", "#ff000080");
+  $(style, addCharactersAttribute, "color", "red");
+  $(style, addIntegerAttribute, "padding", 4);
+  $(style, addEnumAttribute, "alignment", ViewAlignmentNames, ViewAlignmentMiddleCenter);
+  $(style, addIntegerAttribute, "application-defined", 1);
+
+  ck_assert_int_eq(6, style->numValues);
+
+  for (size_t i = 1; i < style->numValues; i++) {
+    ck_assert_int_lt(style->values[i - 1]->property, style->values[i]->property);
+  }
+
+  ck_assert(StyleHasProperty(style, StylePropertyBackgroundColor));
+  ck_assert(!StyleHasProperty(style, StylePropertyFrame));
+
+  const StyleProperty applicationDefined = MVC_StylePropertyForName("application-defined");
+  ck_assert_int_ge(applicationDefined, StylePropertyApplicationDefined);
+  ck_assert_str_eq("application-defined", MVC_StylePropertyName(applicationDefined));
+
+  View *view = $(alloc(View), initWithFrame, NULL);
+  $(view, applyStyle, style);
+
+  ck_assert_int_eq(128, view->backgroundColor.b);
+  ck_assert_int_eq(255, view->borderColor.r);
+  ck_assert_int_eq(0x80, view->borderColor.a);
+  ck_assert_int_eq(4, view->padding.top);
+  ck_assert_int_eq(4, view->padding.left);
+  ck_assert_int_eq(ViewAlignmentMiddleCenter, view->alignment);
+
+  StyleValue *color = $(style, valueForProperty, StylePropertyColor);
+  ck_assert_ptr_ne(NULL, color);
+  ck_assert_int_eq(255, color->color.r);
+
+  $(style, removeAttribute, "color");
+  ck_assert_ptr_eq(NULL, $(style, valueForProperty, StylePropertyColor));
+  ck_assert_int_eq(5, style->numValues);
+
+  release(view);
+  release(style);
+
+} END_TEST
+
+START_TEST(parse) {
+
+  Array *styles = $$(Style, parse, "\
+    /* leading comment */ \
+    Box, Panel /* within a selector */ .title { \
+      border-width: 1; /* trailing comment */ \
+      padding: 4 8, 4 8; \
+      hidden: false; \
+      font-family: Coda Regular \
+    } \
+    } \
+    Label { color: ; : red; width } \
+    Button { height: 24; \
+  ");
+
+  ck_assert_int_eq(2, styles->count);
+
+  const Style *style = $(styles, firstObject);
+  ck_assert_int_eq(2, style->selectors->count);
+  ck_assert_int_eq(4, style->attributes->count);
+
+  const Number *borderWidth = $(style, attributeValue, "border-width");
+  ck_assert_int_eq(1, borderWidth->value);
+
+  const Array *padding = $(style, attributeValue, "padding");
+  ck_assert_int_eq(4, padding->count);
+
+  ck_assert_ptr_eq($$(Boole, False), $(style, attributeValue, "hidden"));
+
+  const String *fontFamily = $(style, attributeValue, "font-family");
+  ck_assert_str_eq("Coda Regular", fontFamily->chars);
+
+  style = $(styles, lastObject);
+  ck_assert_int_eq(0, style->attributes->count);
+
+  release(styles);
+
+} END_TEST
+
+START_TEST(precedence) {
+
+  Array *styles = $$(Style, parse, "\
+    View { \
+      max-height: 10; \
+      max-size: 640 480; \
+      min-width: 16; \
+      min-size: 32 32; \
+    } \
+  ");
+
+  const Style *style = $(styles, firstObject);
+
+  View *view = $(alloc(View), initWithFrame, NULL);
+  $(view, applyStyle, style);
+
+  ck_assert_int_eq(640, view->maxSize.w);
+  ck_assert_int_eq(10, view->maxSize.h);
+  ck_assert_int_eq(16, view->minSize.w);
+  ck_assert_int_eq(32, view->minSize.h);
+
+  release(view);
+  release(styles);
+
+} END_TEST
+
 int main(int argc, char **argv) {
 
   TCase *tcase = tcase_create("Style");
   tcase_add_test(tcase, style);
+  tcase_add_test(tcase, values);
+  tcase_add_test(tcase, parse);
+  tcase_add_test(tcase, precedence);
 
   Suite *suite = suite_create("Style");
   suite_add_tcase(suite, tcase);
@@ -0,0 +1,121 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+/**
+ * @brief The Inlet-based View::applyStyle that preceded StyleValue, kept as the baseline.
+ */
+static void legacyApplyStyle(View *self, const Style *style) {
+
+  const Inlet inlets[] = MakeInlets(
+    MakeInlet("alignment", InletTypeEnum, &self->alignment, (ident) ViewAlignmentNames),
+    MakeInlet("autoresizing-mask", InletTypeEnum, &self->autoresizingMask, (ident) ViewAutoresizingNames),
+    MakeInlet("background-color", InletTypeColor, &self->backgroundColor, NULL),
+    MakeInlet("border-color", InletTypeColor, &self->borderColor, NULL),
+    MakeInlet("border-width", InletTypeInteger, &self->borderWidth, NULL),
+    MakeInlet("clips-subviews", InletTypeBool, &self->clipsSubviews, NULL),
+    MakeInlet("frame", InletTypeRectangle, &self->frame, NULL),
+    MakeInlet("hidden", InletTypeBool, &self->hidden, NULL),
+    MakeInlet("height", InletTypeInteger, &self->frame.h, NULL),
+    MakeInlet("left", InletTypeInteger, &self->frame.x, NULL),
+    MakeInlet("max-height", InletTypeInteger, &self->maxSize.h, NULL),
+    MakeInlet("max-size", InletTypeSize, &self->maxSize, NULL),
+    MakeInlet("max-width", InletTypeInteger, &self->maxSize.w, NULL),
+    MakeInlet("min-height", InletTypeInteger, &self->minSize.h, NULL),
+    MakeInlet("min-size", InletTypeSize, &self->minSize, NULL),
+    MakeInlet("min-width", InletTypeInteger, &self->minSize.w, NULL),
+    MakeInlet("padding", InletTypeRectangle, &self->padding, NULL),
+    MakeInlet("padding-top", InletTypeInteger, &self->padding.top, NULL),
+    MakeInlet("padding-right", InletTypeInteger, &self->padding.right, NULL),
+    MakeInlet("padding-bottom", InletTypeInteger, &self->padding.bottom, NULL),
+    MakeInlet("padding-left", InletTypeInteger, &self->padding.left, NULL),
+    MakeInlet("top", InletTypeInteger, &self->frame.y, NULL),
+    MakeInlet("width", InletTypeInteger, &self->frame.w, NULL)
+  );
+
+  $(self, bind, inlets, style->attributes);
+}
+
+/**
+ * @brief Measures View::applyStyle throughput for a representative Style, against the legacy
+ * Inlet-based path.
+ * @remarks This is not part of `make check`. Build and run it with `make benchmarks`.
+ */
+int main(int argc, char **argv) {
+
+  const int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+
+  Array *styles = $$(Style, parse, "\
+    View { \
+      alignment: top-left; \
+      autoresizing-mask: width | height; \
+      background-color: #202020ff; \
+      border-color: silver; \
+      border-width: 1; \
+      clips-subviews: true; \
+      max-size: 640 480; \
+      min-size: 32 32; \
+      padding: 4 8 4 8; \
+    } \
+  ");
+
+  const Style *style = $(styles, firstObject);
+
+  View *view = $(alloc(View), initWithFrame, NULL);
+
+  clock_t start = clock();
+
+  for (int i = 0; i < iterations; i++) {
+    legacyApplyStyle(view, style);
+  }
+
+  const double legacySeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+  printf("Inlet bind: %d views in %.3fs (%.0f views/s)\n",
+         iterations, legacySeconds, iterations / legacySeconds);
+
+  start = clock();
+
+  for (int i = 0; i < iterations; i++) {
+    $(view, applyStyle, style);
+  }
+
+  const double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+  printf("View::applyStyle: %d views in %.3fs (%.0f views/s)\n",
+         iterations, seconds, iterations / seconds);
+
+  printf("Speedup: %.2fx\n", legacySeconds / seconds);
+
+  release(view);
+  release(styles);
+
+  return 0;
+}
@@ -22,10 +22,12 @@
  */
 
 #include <check.h>
+#include <string.h>
 
 #include <Objectively.h>
 
 #include "ObjectivelyMVC.h"
+#include "ObjectivelyMVC/CompiledData.h"
 
 START_TEST(stylesheet) {
 
@@ -114,10 +116,111 @@ START_TEST(stylesheet) {
 
 } END_TEST
 
+START_TEST(compiled) {
+
+  Stylesheet *stylesheet = $$(Stylesheet, defaultStylesheet);
+  ck_assert_ptr_ne(NULL, stylesheet);
+
+  Data *data = $(stylesheet, compiledData);
+  ck_assert_ptr_ne(NULL, data);
+
+  Stylesheet *compiled = $$(Stylesheet, stylesheetWithData, data);
+  ck_assert_ptr_ne(NULL, compiled);
+
+  ck_assert($((Object *) stylesheet, isEqual, (Object *) compiled));
+  ck_assert_int_eq(stylesheet->selectors->count, compiled->selectors->count);
+
+  for (size_t i = 0; i < compiled->selectors->count; i++) {
+
+    const Selector *a = $(stylesheet->selectors, objectAtIndex, i);
+    const Selector *b = $(compiled->selectors, objectAtIndex, i);
+
+    ck_assert_int_eq(a->specificity, b->specificity);
+    ck_assert_int_eq(a->sequences->count, b->sequences->count);
+    ck_assert_ptr_ne(NULL, b->style);
+  }
+
+  release(compiled);
+
+  Data *truncated = $$(Data, dataWithBytes, data->bytes, data->length - 1);
+  ck_assert_ptr_eq(NULL, $$(Stylesheet, stylesheetWithCompiledData, truncated));
+
+  release(truncated);
+  release(data);
+
+} END_TEST
+
+START_TEST(blankSequence) {
+
+  MutableData *data = $$(MutableData, dataWithCapacity, 64);
+  ck_assert_ptr_ne(NULL, data);
+
+  $(data, appendBytes, (const uint8_t *) STYLESHEET_COMPILED_MAGIC, 4);
+  MVC_WriteCompiledInteger(data, STYLESHEET_COMPILED_VERSION);
+
+  MVC_WriteCompiledInteger(data, 1);
+  MVC_WriteCompiledInteger(data, 1);
+  MVC_WriteCompiledString(data, "a");
+  MVC_WriteCompiledInteger(data, 1);
+  MVC_WriteCompiledString(data, " \t");
+  MVC_WriteCompiledInteger(data, SequenceCombinatorNone);
+  MVC_WriteCompiledInteger(data, SequenceCombinatorNone);
+  MVC_WriteCompiledInteger(data, 1);
+  MVC_WriteCompiledInteger(data, SimpleSelectorTypeType);
+  MVC_WriteCompiledString(data, "a");
+  MVC_WriteCompiledInteger(data, 0);
+
+  ck_assert_ptr_eq(NULL, $$(Stylesheet, stylesheetWithCompiledData, (Data *) data));
+
+  release(data);
+
+} END_TEST
+
+START_TEST(changedSelectors) {
+
+  Stylesheet *stylesheet = $$(Stylesheet, stylesheetWithCharacters, "\
+    Box { padding: 4; } \
+    Label, .unchanged { color: red; } \
+    .removed { hidden: true; } \
+  ");
+
+  Stylesheet *revision = $$(Stylesheet, stylesheetWithCharacters, "\
+    Box { padding: 8; } \
+    Label, .unchanged { color: red; } \
+    .added { hidden: true; } \
+  ");
+
+  Array *selectors = $(stylesheet, changedSelectors, revision);
+  ck_assert_int_eq(3, selectors->count);
+
+  bool box = false, added = false, removed = false;
+  for (size_t i = 0; i < selectors->count; i++) {
+    const Selector *selector = $(selectors, objectAtIndex, i);
+    box |= strcmp("Box", selector->rule) == 0;
+    added |= strcmp(".added", selector->rule) == 0;
+    removed |= strcmp(".removed", selector->rule) == 0;
+  }
+
+  ck_assert(box && added && removed);
+
+  release(selectors);
+
+  selectors = $(stylesheet, changedSelectors, stylesheet);
+  ck_assert_int_eq(0, selectors->count);
+
+  release(selectors);
+  release(revision);
+  release(stylesheet);
+
+} END_TEST
+
 int main(int argc, char **argv) {
 
   TCase *tcase = tcase_create("Stylesheet");
   tcase_add_test(tcase, stylesheet);
+  tcase_add_test(tcase, compiled);
+  tcase_add_test(tcase, blankSequence);
+  tcase_add_test(tcase, changedSelectors);
 
   Suite *suite = suite_create("Stylesheet");
   suite_add_tcase(suite, tcase);
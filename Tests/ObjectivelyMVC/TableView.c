@@ -0,0 +1,583 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+/**
+ * @brief The data source values.
+ */
+static intptr_t values[128];
+
+/**
+ * @brief The number of data source values.
+ */
+static size_t numberOfValues;
+
+/**
+ * @brief Resets the data source to `count` ascending values.
+ */
+static void setValues(size_t count) {
+
+  ck_assert_uint_le(count, lengthof(values));
+
+  for (size_t i = 0; i < count; i++) {
+    values[i] = (intptr_t) i;
+  }
+
+  numberOfValues = count;
+}
+
+/**
+ * @brief Inserts `value` at `index` in the data source.
+ */
+static void insertValue(size_t index, intptr_t value) {
+
+  ck_assert_uint_lt(numberOfValues, lengthof(values));
+
+  memmove(values + index + 1, values + index, (numberOfValues - index) * sizeof(intptr_t));
+  values[index] = value;
+
+  numberOfValues++;
+}
+
+/**
+ * @brief Removes the value at `index` from the data source.
+ */
+static intptr_t removeValue(size_t index) {
+
+  const intptr_t value = values[index];
+
+  memmove(values + index, values + index + 1, (numberOfValues - index - 1) * sizeof(intptr_t));
+  numberOfValues--;
+
+  return value;
+}
+
+/**
+ * @see TableViewDataSource::numberOfRows
+ */
+static size_t numberOfRows(const TableView *tableView) {
+  return numberOfValues;
+}
+
+/**
+ * @see TableViewDataSource::valueForColumnAndRow
+ */
+static ident valueForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+
+  if (strcmp(column->identifier, "group") == 0) {
+    return (ident) (values[row] % 3);
+  }
+
+  return (ident) values[row];
+}
+
+/**
+ * @brief Comparator for data source values.
+ */
+static Order compareValues(const ident a, const ident b) {
+
+  const intptr_t valueA = (intptr_t) a;
+  const intptr_t valueB = (intptr_t) b;
+
+  return valueA < valueB ? OrderAscending : valueA > valueB ? OrderDescending : OrderSame;
+}
+
+/**
+ * @see TableViewDelegate::cellForColumnAndRow
+ */
+static TableCellView *cellForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+
+  TableCellView *cell = $(tableView, dequeueReusableCell, column);
+  if (cell == NULL) {
+    cell = $(alloc(TableCellView), initWithFrame, NULL);
+  }
+
+  char text[32];
+  snprintf(text, sizeof(text), "%zd", (ssize_t) values[row]);
+
+  $(cell->text, setText, text);
+  return cell;
+}
+
+/**
+ * @return A new TableView of one column, presenting the data source.
+ */
+static TableView *createTableView(bool virtualized) {
+
+  TableView *tableView = $(alloc(TableView), initWithFrame, &MakeRect(0, 0, 200, 200));
+  ck_assert_ptr_ne(NULL, tableView);
+
+  tableView->virtualized = virtualized;
+
+  $(tableView, addColumnWithIdentifier, "value");
+
+  tableView->dataSource.numberOfRows = numberOfRows;
+  tableView->dataSource.valueForColumnAndRow = valueForColumnAndRow;
+  tableView->delegate.cellForColumnAndRow = cellForColumnAndRow;
+
+  $(tableView, reloadData);
+  $((View *) tableView, layoutIfNeeded);
+
+  return tableView;
+}
+
+/**
+ * @brief Asserts that each instantiated row of `tableView` presents its data source value.
+ */
+static void assertRows(const TableView *tableView) {
+
+  ck_assert_uint_eq(numberOfValues, tableView->numberOfRows);
+
+  const Array *rows = (Array *) tableView->rows;
+  ck_assert_uint_gt(rows->count, 0);
+
+  for (size_t i = 0; i < rows->count; i++) {
+
+    const TableRowView *row = rows->elements[i];
+    const TableCellView *cell = $((Array *) row->cells, firstObject);
+    ck_assert_ptr_ne(NULL, cell);
+
+    char text[32];
+    snprintf(text, sizeof(text), "%zd", (ssize_t) values[$(tableView, sourceRow, tableView->firstRow + i)]);
+
+    ck_assert_str_eq(text, cell->text->text);
+  }
+}
+
+/**
+ * @brief Asserts that exactly the given rows of `tableView` are selected.
+ */
+static void assertSelection(const TableView *tableView, const size_t *rows, size_t count) {
+
+  IndexSet *selection = $(tableView, selectedRowIndexes);
+  ck_assert_ptr_ne(NULL, selection);
+
+  ck_assert_uint_eq(count, selection->count);
+
+  for (size_t i = 0; i < count; i++) {
+    ck_assert($(tableView, isRowSelected, rows[i]));
+  }
+
+  release(selection);
+}
+
+START_TEST(insertRowsAtIndexes) {
+
+  for (int virtualized = 0; virtualized < 2; virtualized++) {
+
+    setValues(5);
+
+    TableView *tableView = createTableView(virtualized);
+
+    $(tableView, selectRowAtIndex, 1);
+    $(tableView, selectRowAtIndex, 3);
+
+    insertValue(0, 10);
+    insertValue(3, 11);
+
+    IndexSet *indexes = $(alloc(IndexSet), initWithIndexes, (size_t[]) { 0, 3 }, 2);
+    $(tableView, insertRowsAtIndexes, indexes);
+    release(indexes);
+
+    $((View *) tableView, layoutIfNeeded);
+
+    assertRows(tableView);
+    assertSelection(tableView, (size_t[]) { 2, 5 }, 2);
+
+    release(tableView);
+  }
+
+} END_TEST
+
+START_TEST(deleteRowsAtIndexes) {
+
+  for (int virtualized = 0; virtualized < 2; virtualized++) {
+
+    setValues(6);
+
+    TableView *tableView = createTableView(virtualized);
+
+    $(tableView, selectRowAtIndex, 2);
+    $(tableView, selectRowAtIndex, 4);
+
+    removeValue(2);
+    removeValue(1);
+
+    IndexSet *indexes = $(alloc(IndexSet), initWithIndexes, (size_t[]) { 1, 2 }, 2);
+    $(tableView, deleteRowsAtIndexes, indexes);
+    release(indexes);
+
+    $((View *) tableView, layoutIfNeeded);
+
+    assertRows(tableView);
+    assertSelection(tableView, (size_t[]) { 2 }, 1);
+
+    release(tableView);
+  }
+
+} END_TEST
+
+START_TEST(moveRow) {
+
+  for (int virtualized = 0; virtualized < 2; virtualized++) {
+
+    setValues(5);
+
+    TableView *tableView = createTableView(virtualized);
+
+    $(tableView, selectRowAtIndex, 1);
+    $(tableView, selectRowAtIndex, 3);
+
+    insertValue(3, removeValue(1));
+
+    $(tableView, moveRow, 1, 3);
+
+    $((View *) tableView, layoutIfNeeded);
+
+    assertRows(tableView);
+    assertSelection(tableView, (size_t[]) { 2, 3 }, 2);
+
+    release(tableView);
+  }
+
+} END_TEST
+
+START_TEST(contentPadding) {
+
+  setValues(100);
+
+  TableView *tableView = createTableView(true);
+
+  View *contentView = (View *) tableView->contentView;
+  contentView->padding = MakePadding(7, 0, 3, 0);
+
+  tableView->scrollView->contentOffset.y = -24 * 50;
+  $((View *) tableView, layoutIfNeeded);
+
+  const size_t first = tableView->firstRow;
+  const size_t last = first + ((Array *) tableView->rows)->count;
+
+  ck_assert_uint_gt(first, 0);
+  ck_assert_uint_lt(last, numberOfValues);
+
+  ck_assert_int_eq(7 + (int) first * 24, contentView->padding.top);
+  ck_assert_int_eq(3 + (int) (numberOfValues - last) * 24, contentView->padding.bottom);
+
+  tableView->scrollView->contentOffset.y = 0;
+  $((View *) tableView, layoutIfNeeded);
+
+  ck_assert_uint_eq(0, tableView->firstRow);
+  ck_assert_int_eq(7, contentView->padding.top);
+
+  release(tableView);
+
+} END_TEST
+
+START_TEST(setSortColumn) {
+
+  setValues(9);
+
+  TableView *tableView = createTableView(false);
+
+  $(tableView, addColumnWithIdentifier, "group");
+  $(tableView, reloadData);
+  $((View *) tableView, layoutIfNeeded);
+
+  TableColumn *value = $(tableView, columnWithIdentifier, "value");
+  TableColumn *group = $(tableView, columnWithIdentifier, "group");
+
+  value->comparator = compareValues;
+  group->comparator = compareValues;
+
+  $(tableView, setSortColumn, value);
+  $(tableView, setSortColumn, value);
+
+  ck_assert_int_eq(OrderDescending, value->order);
+
+  for (size_t i = 0; i < numberOfValues; i++) {
+    ck_assert_int_eq(8 - (intptr_t) i, values[$(tableView, sourceRow, i)]);
+  }
+
+  $(tableView, selectRowAtIndex, 0);
+  $(tableView, selectRowAtIndex, 4);
+
+  $(tableView, setSortColumn, group);
+
+  ck_assert_int_eq(OrderSame, value->order);
+  ck_assert_int_eq(OrderAscending, group->order);
+
+  const intptr_t sorted[] = { 6, 3, 0, 7, 4, 1, 8, 5, 2 };
+  for (size_t i = 0; i < lengthof(sorted); i++) {
+    ck_assert_int_eq(sorted[i], values[$(tableView, sourceRow, i)]);
+  }
+
+  assertRows(tableView);
+  assertSelection(tableView, (size_t[]) { 4, 6 }, 2);
+
+  $(tableView, setSortColumn, group);
+
+  for (size_t i = 0; i < lengthof(sorted); i++) {
+    ck_assert_int_eq(sorted[lengthof(sorted) - 1 - i], values[$(tableView, sourceRow, i)]);
+  }
+
+  assertRows(tableView);
+  assertSelection(tableView, (size_t[]) { 2, 4 }, 2);
+
+  insertValue(0, 9);
+
+  IndexSet *indexes = $(alloc(IndexSet), initWithIndexes, (size_t[]) { 0 }, 1);
+  $(tableView, insertRowsAtIndexes, indexes);
+  release(indexes);
+
+  const intptr_t inserted[] = { 2, 5, 8, 1, 4, 7, 9, 0, 3, 6 };
+  for (size_t i = 0; i < lengthof(inserted); i++) {
+    ck_assert_int_eq(inserted[i], values[$(tableView, sourceRow, i)]);
+  }
+
+  assertRows(tableView);
+  assertSelection(tableView, (size_t[]) { 2, 4 }, 2);
+
+  release(tableView);
+
+} END_TEST
+
+START_TEST(rowAtPoint) {
+
+  setValues(5);
+
+  TableView *tableView = createTableView(false);
+
+  ((View *) tableView->scrollView)->frame = MakeRect(0, 20, 200, 300);
+
+  const Array *rows = (Array *) tableView->rows;
+  ck_assert_uint_eq(5, rows->count);
+
+  for (size_t i = 0; i < rows->count; i++) {
+    View *row = rows->elements[i];
+    row->frame = MakeRect(0, (int) i * 26, 200, 24);
+  }
+
+  for (size_t i = 0; i < rows->count; i++) {
+
+    const SDL_Rect frame = $((View *) rows->elements[i], renderFrame);
+
+    ck_assert_int_eq((ssize_t) i, $(tableView, rowAtPoint, &MakePoint(frame.x, frame.y)));
+    ck_assert_int_eq((ssize_t) i, $(tableView, rowAtPoint, &MakePoint(frame.x, frame.y + frame.h - 1)));
+    ck_assert_int_eq(-1, $(tableView, rowAtPoint, &MakePoint(frame.x, frame.y + frame.h)));
+  }
+
+  const SDL_Rect last = $((View *) $(rows, lastObject), renderFrame);
+  ck_assert_int_eq(-1, $(tableView, rowAtPoint, &MakePoint(last.x, last.y + 26)));
+
+  const SDL_Rect scrollFrame = $((View *) tableView->scrollView, renderFrame);
+  ck_assert_int_eq(-1, $(tableView, rowAtPoint, &MakePoint(scrollFrame.x, scrollFrame.y - 1)));
+
+  release(tableView);
+
+} END_TEST
+
+START_TEST(rowAtPointVirtualized) {
+
+  setValues(5);
+
+  TableView *tableView = createTableView(true);
+
+  View *contentView = (View *) tableView->contentView;
+  contentView->padding.top = 6;
+
+  $((View *) tableView, layoutIfNeeded);
+
+  ck_assert_int_eq(6, tableView->contentPadding.top);
+
+  ((View *) tableView->scrollView)->frame = MakeRect(0, 20, 200, 300);
+
+  const SDL_Rect contentFrame = $(contentView, renderFrame);
+  const int top = contentFrame.y + 6;
+
+  for (size_t i = 0; i < numberOfValues; i++) {
+
+    const int y = top + (int) i * tableView->rowHeight;
+
+    ck_assert_int_eq((ssize_t) i, $(tableView, rowAtPoint, &MakePoint(contentFrame.x, y)));
+    ck_assert_int_eq((ssize_t) i, $(tableView, rowAtPoint, &MakePoint(contentFrame.x, y + tableView->rowHeight - 1)));
+  }
+
+  ck_assert_int_eq(-1, $(tableView, rowAtPoint, &MakePoint(contentFrame.x, top - 1)));
+  ck_assert_int_eq(-1, $(tableView, rowAtPoint, &MakePoint(contentFrame.x, top + 5 * tableView->rowHeight)));
+
+  release(tableView);
+
+} END_TEST
+
+START_TEST(columnAtPoint) {
+
+  setValues(5);
+
+  TableView *tableView = createTableView(false);
+
+  $(tableView, addColumnWithIdentifier, "group");
+
+  ((View *) tableView)->frame = MakeRect(0, 0, 200, 320);
+  ((View *) tableView->headerView)->frame = MakeRect(0, 0, 200, 20);
+
+  const Array *cells = (Array *) tableView->headerView->tableRowView.cells;
+  ck_assert_uint_eq(2, cells->count);
+
+  for (size_t i = 0; i < cells->count; i++) {
+    View *cell = cells->elements[i];
+    cell->frame = MakeRect((int) i * 84, 0, 80, 20);
+  }
+
+  const TableColumn *value = $(tableView, columnWithIdentifier, "value");
+  const TableColumn *group = $(tableView, columnWithIdentifier, "group");
+
+  const SDL_Rect first = $((View *) cells->elements[0], renderFrame);
+  const SDL_Rect second = $((View *) cells->elements[1], renderFrame);
+
+  ck_assert_ptr_eq(value, $(tableView, columnAtPoint, &MakePoint(first.x, first.y)));
+  ck_assert_ptr_eq(value, $(tableView, columnAtPoint, &MakePoint(first.x + first.w - 1, first.y)));
+  ck_assert_ptr_eq(NULL, $(tableView, columnAtPoint, &MakePoint(first.x + first.w, first.y)));
+  ck_assert_ptr_eq(NULL, $(tableView, columnAtPoint, &MakePoint(second.x - 1, first.y)));
+  ck_assert_ptr_eq(group, $(tableView, columnAtPoint, &MakePoint(second.x, second.y)));
+  ck_assert_ptr_eq(group, $(tableView, columnAtPoint, &MakePoint(second.x + second.w - 1, second.y)));
+  ck_assert_ptr_eq(NULL, $(tableView, columnAtPoint, &MakePoint(second.x + second.w, second.y)));
+
+  const SDL_Rect frame = $((View *) tableView, renderFrame);
+  ck_assert_ptr_eq(NULL, $(tableView, columnAtPoint, &MakePoint(frame.x + frame.w, first.y)));
+
+  release(tableView);
+
+} END_TEST
+
+/**
+ * @brief The data source Strings for TableCellRenderer columns.
+ */
+static String *strings[4];
+
+/**
+ * @see TableViewDataSource::valueForColumnAndRow
+ */
+static ident stringForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+  return strings[row];
+}
+
+/**
+ * @brief Comparator for data source Strings.
+ */
+static Order compareStrings(const ident a, const ident b) {
+
+  const int order = strcmp(((const String *) a)->chars, ((const String *) b)->chars);
+
+  return order < 0 ? OrderAscending : order > 0 ? OrderDescending : OrderSame;
+}
+
+/**
+ * @see TableCellRenderer::drawCell
+ */
+static void drawCell(const TableColumn *column, const TableRowView *row, Renderer *renderer, const SDL_Rect *frame, ident value) {
+}
+
+START_TEST(cellRenderer) {
+
+  for (size_t i = 0; i < lengthof(strings); i++) {
+    strings[i] = $$(String, stringWithFormat, "%zd", i);
+  }
+
+  setValues(lengthof(strings));
+
+  TableView *tableView = $(alloc(TableView), initWithFrame, &MakeRect(0, 0, 200, 200));
+  ck_assert_ptr_ne(NULL, tableView);
+
+  TableColumn *column = $(alloc(TableColumn), initWithIdentifier, "string");
+  column->cellRenderer.drawCell = drawCell;
+  column->comparator = compareStrings;
+  column->retainsValues = true;
+
+  $(tableView, addColumn, column);
+
+  tableView->dataSource.numberOfRows = numberOfRows;
+  tableView->dataSource.valueForColumnAndRow = stringForColumnAndRow;
+
+  $(tableView, reloadData);
+  $((View *) tableView, layoutIfNeeded);
+
+  $(tableView, setSortColumn, column);
+  $(tableView, setSortColumn, column);
+
+  for (size_t i = 0; i < lengthof(strings); i++) {
+    release(strings[i]);
+    strings[i] = NULL;
+  }
+
+  const Array *rows = (Array *) tableView->rows;
+  ck_assert_uint_eq(lengthof(strings), rows->count);
+
+  for (size_t i = 0; i < rows->count; i++) {
+
+    const TableRowView *row = rows->elements[i];
+    ck_assert_uint_eq(1, row->numValues);
+    ck_assert_uint_eq(0, row->cells->count);
+
+    char text[32];
+    snprintf(text, sizeof(text), "%zd", lengthof(strings) - 1 - i);
+
+    ck_assert_str_eq(text, ((String *) row->values[0])->chars);
+  }
+
+  release(column);
+  release(tableView);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("TableView");
+  tcase_add_test(tcase, insertRowsAtIndexes);
+  tcase_add_test(tcase, deleteRowsAtIndexes);
+  tcase_add_test(tcase, moveRow);
+  tcase_add_test(tcase, contentPadding);
+  tcase_add_test(tcase, setSortColumn);
+  tcase_add_test(tcase, rowAtPoint);
+  tcase_add_test(tcase, rowAtPointVirtualized);
+  tcase_add_test(tcase, columnAtPoint);
+  tcase_add_test(tcase, cellRenderer);
+
+  Suite *suite = suite_create("TableView");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
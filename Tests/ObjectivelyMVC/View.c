@@ -0,0 +1,103 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+START_TEST(clone) {
+
+  TableCellView *prototype = $(alloc(TableCellView), initWithFrame, &MakeRect(0, 0, 120, 24));
+  ck_assert_ptr_ne(NULL, prototype);
+
+  $((View *) prototype, addClassName, "cell");
+  $(prototype->text, setText, "prototype");
+
+  TableCellView *cell = (TableCellView *) $((View *) prototype, clone);
+  ck_assert_ptr_ne(NULL, cell);
+  ck_assert_ptr_eq(_TableCellView(), classof(cell));
+
+  ck_assert_ptr_ne(NULL, cell->text);
+  ck_assert_ptr_ne(prototype->text, cell->text);
+  ck_assert_ptr_eq(cell, cell->text->view.superview);
+  ck_assert_str_eq("prototype", cell->text->text);
+  ck_assert_int_eq(1, ((View *) cell)->subviews->count);
+
+  ck_assert($((View *) cell, hasClassName, "cell"));
+  ck_assert_int_eq(120, ((View *) cell)->frame.w);
+
+  $(cell->text, setText, "clone");
+  ck_assert_str_eq("clone", cell->text->text);
+  ck_assert_str_eq("prototype", prototype->text->text);
+
+  release(cell);
+  release(prototype);
+
+} END_TEST
+
+START_TEST(cloneItem) {
+
+  CollectionItemView *prototype = $(alloc(CollectionItemView), initWithFrame, &MakeRect(0, 0, 64, 64));
+  ck_assert_ptr_ne(NULL, prototype);
+
+  CollectionItemView *item = (CollectionItemView *) $((View *) prototype, clone);
+  ck_assert_ptr_ne(NULL, item);
+
+  ck_assert_ptr_ne(NULL, item->imageView);
+  ck_assert_ptr_ne(NULL, item->selectionOverlay);
+  ck_assert_ptr_ne(NULL, item->text);
+
+  ck_assert_ptr_eq(item, item->imageView->view.superview);
+  ck_assert_ptr_eq(item, item->selectionOverlay->superview);
+  ck_assert_ptr_eq(item, item->text->view.superview);
+
+  ck_assert($(item->selectionOverlay, hasClassName, "selectionOverlay"));
+
+  ck_assert_ptr_eq(item->text, $((View *) item, counterpart, (View *) prototype, (View *) prototype->text));
+  ck_assert_ptr_eq(NULL, $((View *) item, counterpart, (View *) prototype, (View *) item->text));
+
+  release(item);
+  release(prototype);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("View");
+  tcase_add_test(tcase, clone);
+  tcase_add_test(tcase, cloneItem);
+
+  Suite *suite = suite_create("View");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
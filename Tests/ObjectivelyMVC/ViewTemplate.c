@@ -0,0 +1,147 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include "ObjectivelyMVC.h"
+
+START_TEST(compiled) {
+
+  const char *json = "{ \
+    \"identifier\": \"root\", \
+    \"classNames\": [\"container\"], \
+    \"style\": { \"width\": 320, \"hidden\": false, \"padding\": [1, 2, 3, 4] }, \
+    \"subviews\": [ \
+      { \"identifier\": \"first\", \"classNames\": [\"container\"] }, \
+      { \"identifier\": \"second\", \"extra\": null } \
+    ] \
+  }";
+
+  Data *data = $$(Data, dataWithConstMemory, (ident) json, strlen(json));
+  ck_assert_ptr_ne(NULL, data);
+
+  ViewTemplate *viewTemplate = $$(ViewTemplate, viewTemplateWithData, data);
+  ck_assert_ptr_ne(NULL, viewTemplate);
+  ck_assert(!MVC_IsCompiledViewTemplate(data));
+
+  Data *compiled = $(viewTemplate, compiledData);
+  ck_assert_ptr_ne(NULL, compiled);
+  ck_assert(MVC_IsCompiledViewTemplate(compiled));
+
+  ViewTemplate *copy = $$(ViewTemplate, viewTemplateWithData, compiled);
+  ck_assert_ptr_ne(NULL, copy);
+  ck_assert($((Object *) viewTemplate->dictionary, isEqual, (Object *) copy->dictionary));
+
+  const Array *subviews = $(copy->dictionary, objectForKeyPath, "subviews");
+  ck_assert_int_eq(2, subviews->count);
+
+  const Array *a = $(copy->dictionary, objectForKeyPath, "classNames");
+  const Array *b = $((Dictionary *) $(subviews, firstObject), objectForKeyPath, "classNames");
+  ck_assert_ptr_eq($(a, firstObject), $(b, firstObject));
+
+  Data *recompiled = $(copy, compiledData);
+  ck_assert_int_eq(compiled->length, recompiled->length);
+  ck_assert_int_eq(0, memcmp(compiled->bytes, recompiled->bytes, compiled->length));
+
+  Data *truncated = $$(Data, dataWithBytes, compiled->bytes, compiled->length - 1);
+  ck_assert_ptr_eq(NULL, $$(ViewTemplate, viewTemplateWithData, truncated));
+
+  release(truncated);
+  release(recompiled);
+  release(copy);
+  release(compiled);
+  release(viewTemplate);
+  release(data);
+
+} END_TEST
+
+START_TEST(instantiate) {
+
+  const char *json = "{ \
+    \"identifier\": \"root\", \
+    \"classNames\": [\"container\"], \
+    \"style\": { \"width\": 320 }, \
+    \"subviews\": [ \
+      { \"class\": \"StackView\", \"identifier\": \"stack\", \"subviews\": [ \
+        { \"class\": \"ImageView\", \"identifier\": \"image\" } \
+      ] }, \
+      { \"identifier\": \"second\" } \
+    ] \
+  }";
+
+  Data *data = $$(Data, dataWithConstMemory, (ident) json, strlen(json));
+  ViewTemplate *viewTemplate = $$(ViewTemplate, viewTemplateWithData, data);
+  ck_assert_ptr_ne(NULL, viewTemplate);
+
+  for (int i = 0; i < 2; i++) {
+
+    View *image = NULL;
+    Outlet outlets[] = MakeOutlets(
+      MakeOutlet("image", &image)
+    );
+
+    View *view = $(viewTemplate, instantiate, outlets);
+    ck_assert_ptr_ne(NULL, view);
+    ck_assert_str_eq("root", view->identifier);
+    ck_assert($(view, hasClassName, "container"));
+    ck_assert_int_eq(2, view->subviews->count);
+
+    const View *stack = $(view, descendantWithIdentifier, "stack");
+    ck_assert_ptr_eq(_StackView(), classof(stack));
+    ck_assert_int_eq(1, stack->subviews->count);
+
+    ck_assert_ptr_ne(NULL, image);
+    ck_assert_ptr_eq(_ImageView(), classof(image));
+    ck_assert_ptr_eq(stack, image->superview);
+
+    release(view);
+  }
+
+  ck_assert_ptr_ne(NULL, viewTemplate->root);
+
+  release(viewTemplate);
+  release(data);
+
+} END_TEST
+
+int main(int argc, char **argv) {
+
+  TCase *tcase = tcase_create("ViewTemplate");
+  tcase_add_test(tcase, compiled);
+  tcase_add_test(tcase, instantiate);
+
+  Suite *suite = suite_create("ViewTemplate");
+  suite_add_tcase(suite, tcase);
+
+  SRunner *runner = srunner_create(suite);
+
+  srunner_run_all(runner, CK_VERBOSE);
+  int failed = srunner_ntests_failed(runner);
+
+  srunner_free(runner);
+
+  return failed;
+}
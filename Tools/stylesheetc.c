@@ -0,0 +1,71 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @file
+ * @brief Compiles CSS Stylesheets to the binary format loaded by Stylesheet::initWithCompiledData.
+ * @details Usage: `stylesheetc input.css output.cssb`
+ */
+
+int main(int argc, char **argv) {
+
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s input.css output.cssb\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const char *input = argv[1];
+  const char *output = argv[2];
+
+  Data *css = $$(Data, dataWithContentsOfFile, input);
+  if (css == NULL) {
+    fprintf(stderr, "%s: Failed to read %s\n", argv[0], input);
+    return EXIT_FAILURE;
+  }
+
+  Stylesheet *stylesheet = $$(Stylesheet, stylesheetWithData, css);
+  if (stylesheet == NULL) {
+    fprintf(stderr, "%s: Failed to parse %s\n", argv[0], input);
+    release(css);
+    return EXIT_FAILURE;
+  }
+
+  Data *data = $(stylesheet, compiledData);
+
+  const bool written = $(data, writeToFile, output);
+  if (written == false) {
+    fprintf(stderr, "%s: Failed to write %s\n", argv[0], output);
+  }
+
+  release(data);
+  release(stylesheet);
+  release(css);
+
+  return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
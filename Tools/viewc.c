@@ -0,0 +1,107 @@
+/*
+ * ObjectivelyMVC: Object oriented MVC framework for SDL3 and C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @file
+ * @brief Compiles JSON View descriptions to the binary ViewTemplate format.
+ * @details Usage: `viewc input.json output.jsonb`
+ */
+
+/**
+ * @brief Warns of any class named in `obj` or its descendants that is not a known View class.
+ * @remarks Unknown classes are not fatal, as layouts may name application-defined classes that
+ * are not linked into this tool. Such classes are resolved when the ViewTemplate is instantiated.
+ */
+static void checkClasses(const char *path, const Object *obj) {
+
+  if ($(obj, isKindOfClass, _Dictionary())) {
+    const Dictionary *dictionary = (Dictionary *) obj;
+
+    const String *className = $(dictionary, objectForKeyPath, "class");
+    if (className) {
+
+      if ($((Object *) className, isKindOfClass, _String())) {
+
+        const Class *clazz = classForName(className->chars);
+        while (clazz && clazz != _View()) {
+          clazz = clazz->def.superclass;
+        }
+
+        if (clazz == NULL) {
+          fprintf(stderr, "%s: warning: %s is not a known View class\n", path, className->chars);
+        }
+      } else {
+        fprintf(stderr, "%s: warning: invalid class name\n", path);
+      }
+    }
+
+    const Array *subviews = $(dictionary, objectForKeyPath, "subviews");
+    if (subviews && $((Object *) subviews, isKindOfClass, _Array())) {
+      for (size_t i = 0; i < subviews->count; i++) {
+        checkClasses(path, subviews->elements[i]);
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s input.json output.jsonb\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Data *json = $$(Data, dataWithContentsOfFile, argv[1]);
+  if (json == NULL) {
+    fprintf(stderr, "%s: Failed to read %s\n", argv[0], argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  ViewTemplate *viewTemplate = $$(ViewTemplate, viewTemplateWithData, json);
+  if (viewTemplate == NULL) {
+    fprintf(stderr, "%s: Failed to parse %s\n", argv[0], argv[1]);
+    release(json);
+    return EXIT_FAILURE;
+  }
+
+  checkClasses(argv[1], (Object *) viewTemplate->dictionary);
+
+  Data *data = $(viewTemplate, compiledData);
+
+  const bool written = $(data, writeToFile, argv[2]);
+  if (written == false) {
+    fprintf(stderr, "%s: Failed to write %s\n", argv[0], argv[2]);
+  }
+
+  release(data);
+  release(viewTemplate);
+  release(json);
+
+  return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}